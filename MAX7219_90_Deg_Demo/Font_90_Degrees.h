@@ -2,7 +2,7 @@
 
 #include <Arduino.h>
 
-const byte Text_Font [][8] PROGMEM = {
+constexpr byte Text_Font [][8] PROGMEM = {
 
   { 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000 },   // 'Space'
   { 0b00110000, 0b01111000, 0b01111000, 0b00110000, 0b00110000, 0b00000000, 0b00110000, 0b00000000 },   // '!'
@@ -103,6 +103,77 @@ const byte Text_Font [][8] PROGMEM = {
 };
 
 
+// ------------------------------------------------------------------------------------------------------------------
+// Rotated font, generated at compile time from Text_Font above so the font stays editable
+// The frame buffer holds one byte per chip row with the left most column in bit 0, the font has it in bit 7.
+// Each glyph row is mirrored into the frame buffer layout, a character can then be written as 8 whole bytes
+// Text_Font_Rotated[((Ascii_Value - 0x20) * 8) + Row] is glyph row Row ready to write into the frame buffer
+// ------------------------------------------------------------------------------------------------------------------
 
+// Mirror the bits of a font row, bit 7 becomes bit 0
+constexpr byte Mirror_Font_Row(byte Row) {
+  return ((Row & 0x01) << 7) | ((Row & 0x02) << 5) | ((Row & 0x04) << 3) | ((Row & 0x08) << 1) |
+         ((Row & 0x10) >> 1) | ((Row & 0x20) >> 3) | ((Row & 0x40) >> 5) | ((Row & 0x80) >> 7);
+}
 
+// List of table indexes 0 to N - 1, built by halving so the template depth stays small
+template <unsigned int... I> struct Font_Index {};
 
+template <class A, class B> struct Font_Index_Join;
+template <unsigned int... A, unsigned int... B> struct Font_Index_Join<Font_Index<A...>, Font_Index<B...> > {
+  typedef Font_Index<A..., (sizeof...(A) + B)...> Type;
+};
+
+template <unsigned int N> struct Make_Font_Index {
+  typedef typename Font_Index_Join<typename Make_Font_Index<N / 2>::Type, typename Make_Font_Index<N - (N / 2)>::Type>::Type Type;
+};
+template <> struct Make_Font_Index<0> { typedef Font_Index<> Type; };
+template <> struct Make_Font_Index<1> { typedef Font_Index<0> Type; };
+
+// The table itself, one mirrored byte for every byte of Text_Font. constexpr, so it can only be built by the compiler
+template <class Index> struct Rotated_Font;
+template <unsigned int... I> struct Rotated_Font<Font_Index<I...> > {
+  static constexpr byte Data[sizeof...(I)] PROGMEM = {
+    Mirror_Font_Row(Text_Font[I / 8][I % 8])...
+  };
+};
+template <unsigned int... I> constexpr byte Rotated_Font<Font_Index<I...> >::Data[sizeof...(I)] PROGMEM;
+
+#define Text_Font_Rotated Rotated_Font<Make_Font_Index<sizeof(Text_Font)>::Type>::Data
+
+
+// ------------------------------------------------------------------------------------------------------------------
+// Glyph metrics for proportional text, generated at compile time from Text_Font above
+// One byte per glyph, the left bearing (first lit column, 0 is the left most) in the high nibble and the width in
+// columns from there to the last lit column in the low nibble. Blank glyphs such as space have a width of 0
+// Text_Font_Metrics[Ascii_Value - 0x20] is the metric for a character
+// ------------------------------------------------------------------------------------------------------------------
+
+// All the columns lit in any row of a glyph, in the rotated layout, bit 0 is the left most column
+constexpr byte Glyph_Columns(unsigned int Glyph, unsigned int Row) {
+  return (Row == 8) ? 0 : (Mirror_Font_Row(Text_Font[Glyph][Row]) | Glyph_Columns(Glyph, Row + 1));
+}
+
+// First and last set bits of a byte, 8 if there are none
+constexpr byte Lowest_Bit(byte Value, byte Bit) {
+  return (Bit == 8 || ((Value >> Bit) & 0x01) == 1) ? Bit : Lowest_Bit(Value, Bit + 1);
+}
+
+constexpr byte Highest_Bit(byte Value, byte Bit) {
+  return (((Value >> Bit) & 0x01) == 1) ? Bit : ((Bit == 0) ? 8 : Highest_Bit(Value, Bit - 1));
+}
+
+constexpr byte Glyph_Metric(byte Columns) {
+  return (Columns == 0) ? 0 : (byte)((Lowest_Bit(Columns, 0) << 4) | (Highest_Bit(Columns, 7) - Lowest_Bit(Columns, 0) + 1));
+}
+
+// The table itself, one byte for every glyph of Text_Font, constexpr as the rotated font
+template <class Index> struct Font_Metrics;
+template <unsigned int... I> struct Font_Metrics<Font_Index<I...> > {
+  static constexpr byte Data[sizeof...(I)] PROGMEM = {
+    Glyph_Metric(Glyph_Columns(I, 0))...
+  };
+};
+template <unsigned int... I> constexpr byte Font_Metrics<Font_Index<I...> >::Data[sizeof...(I)] PROGMEM;
+
+#define Text_Font_Metrics Font_Metrics<Make_Font_Index<sizeof(Text_Font) / 8>::Type>::Data
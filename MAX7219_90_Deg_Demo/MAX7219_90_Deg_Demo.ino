@@ -18,8 +18,27 @@
 */
 
 #include <SPI.h>
+
+//#define MAX7219_STATS                         // Uncomment to report the display statistics over Serial every 5 seconds
 #include "MAX7219_Functions.h"
 
+// MAX7219 items
+#define Number_MAX7219 4                         // Number of MAX7219 chips present
+#define MAX7219_CS  10                             // Pin used for CS. 7=UNO 15=ESP8266
+
+// The display, add more with their own size and CS pin to drive several chains
+MAX7219_Matrix<Number_MAX7219, MAX7219_CS> Display;
+
+//#define MAX7219_BENCHMARK                     // Uncomment to print the benchmarks over Serial at start up
+//#define MAX7219_STREAMING                     // Uncomment to show frames streamed from a PC over Serial in place of the demo
+#ifdef MAX7219_BENCHMARK
+#include "MAX7219_Benchmark.h"
+#endif
+
+// Demo sequence items, the demo steps on once the effect has finished and the pause is over
+int Demo_Step = 0;
+unsigned long Demo_Timer = 0;
+
 void setup() {
 
   Serial.begin(115200);
@@ -36,39 +55,63 @@ void setup() {
 
   delay(1000);
 
-  MAX7219_Init();                               // Set All none data MAX registers
-  Clear_All();                                  // Clear frame buffer and screen
+  Display.MAX7219_Init();                       // Set All none data MAX registers
+  Display.Clear_All();                          // Clear frame buffer and screen
+  Display.Resync_Period = 100000;               // Send one register again every 100mS, an upset display is put right in 1.3 seconds
+
+#ifdef MAX7219_BENCHMARK
+  Benchmark_Run(Display);
+#endif
+
+#ifdef MAX7219_STATS
+  Display.Stats_Report_Period = 5000;
+#endif
 
-  Scroll_Text_Start("Hello MAX7219!", 10); // Write new text to display and restart scroll
+#ifdef MAX7219_STREAMING
+  Display.Stream_Start(Serial);                 // Frames from the PC, see Stream_Sync in MAX7219_Functions.h
+#else
+  Display.Scroll_Text_Start(F("Hello MAX7219!"), 10); // Write new text to display and restart scroll
+#endif
 
 } // end of setup
 
 
 void loop() {
 
+#ifdef MAX7219_STREAMING
+  // Show the frames as they come in, the animation only re-syncs the display
+  Display.Stream_Poll();
+  Display.Animation_Tick();
+  return;
+#endif
 
-  if (Scrolling == true) {
-    Scroll_Update();                        // Update the scrolling display
+  // Run the animation, does one frame at most and returns, loop() is free to do other work
+  Display.Animation_Tick();
+
+  // Wait for the effect to finish, then hold for a second before the next step
+  if (Display.Animation_Running() == true) {
+    Demo_Timer = millis();
   }
-  else {
+  else if (millis() - Demo_Timer >= 1000) {
 
-    // place text
-    delay(1000);
-    Display_Text("Display?", 2);            // (text to display, location(pixels))
-    delay(1000);
+    Demo_Timer = millis();
 
-    // display wipe
-    Wipe_Text_Right("In from Left", 8);     // (text to display, speed)
-    delay(1000);
-    Wipe_Text_Left("Right", 4);     // (text to display, speed)
-    delay(1000);
+    switch (Demo_Step) {
 
-    // display scroll
-    Scroll_Text_Start("Scrolling text right to left.....", 10); // Write new text to display and restart scroll
+      // place text
+      case 0: Display.Display_Text(F("Display?"), 2); break;     // (text to display, location(pixels))
 
-  } // end of else
+      // display wipe
+      case 1: Display.Wipe_Text_Right_Start(F("In from Left"), 8); break; // (text to display, speed)
+      case 2: Display.Wipe_Text_Left_Start(F("Right"), 4); break;         // (text to display, speed)
 
-} // end of loop
+      // display scroll
+      case 3: Display.Scroll_Text_Start(F("Scrolling text right to left....."), 10); break; // Write new text to display and restart scroll
 
+    } // end of switch
 
+    Demo_Step = (Demo_Step + 1) % 4;
 
+  } // end of else
+
+} // end of loop
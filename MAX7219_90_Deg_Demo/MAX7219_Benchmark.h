@@ -0,0 +1,281 @@
+/*
+  Benchmarks for the display functions, results are printed over Serial
+  Define MAX7219_BENCHMARK in the sketch and call Benchmark_Run(Display) from setup()
+*/
+
+#define Benchmark_Characters 2000                 // Characters written for each character benchmark
+#define Benchmark_Refreshes 200                   // Full refreshes sent for each transfer benchmark
+#define Benchmark_Graphics_Ops 500                // Operations timed for each graphics benchmark
+
+
+// ---------------------------------------------------------------------------------------------------
+// Reference character writer, the original bit at a time version using the unrotated font. Used as the
+// baseline for the character benchmark, 64 font reads and 64 bit writes per character
+// ---------------------------------------------------------------------------------------------------
+template <class Matrix> void Write_Character_Bitwise(Matrix &Display, int Ascii_Value) {
+
+  for (int Digit_Colummn = 7; Digit_Colummn > -1; Digit_Colummn--) {
+
+    // Range check for the ascii value
+    if (Ascii_Value > 0x1F && Ascii_Value < 0x7F) {
+
+      int Character_Value = Ascii_Value - 0x20;
+
+      // Range check, don't write to array if less than 0 or greater that the array size
+      if (Display.Column > -1 && Display.Column < Matrix::Columns) {
+
+        int Row_Bit = Display.Column & 0x07;
+        int Array_Data = Display.Column - Row_Bit;
+
+        for (int ii = 0; ii < 8; ii++) {
+
+          int Font_Row = pgm_read_byte(&Text_Font[Character_Value] [ii]);
+
+          if (bitRead(Font_Row, Digit_Colummn) == 1) {
+            bitSet(Display.Frame_Buffer[Array_Data + ii], Row_Bit);
+          }
+          else {
+            bitClear(Display.Frame_Buffer[Array_Data + ii], Row_Bit);
+          }
+
+        } // end of character loop (ii)
+
+      } // end of column range check
+
+      Display.Column++;
+
+    } // end of range check
+
+  } // end of loop
+
+} // end of function
+
+
+// -------------------------------------------------------------------------------------------------------------
+// Time writing characters across the display, Bitwise picks the reference writer, returns characters per second
+// Every column start is used so aligned, unaligned and clipped characters are all in the mix
+// -------------------------------------------------------------------------------------------------------------
+template <class Matrix> unsigned long Benchmark_Character_Writer(Matrix &Display, bool Bitwise) {
+
+  unsigned long Start = micros();
+
+  for (int i = 0; i < Benchmark_Characters; i++) {
+    Display.Column = (i % (Matrix::Columns + 8)) - 4;
+    if (Bitwise == true) {
+      Write_Character_Bitwise(Display, 0x20 + (i % 0x5F));
+    }
+    else {
+      Display.Write_Character(0x20 + (i % 0x5F));
+    }
+  } // end of loop
+
+  unsigned long Time_Taken = micros() - Start;
+  if (Time_Taken == 0) {
+    Time_Taken = 1;
+  }
+
+  return (unsigned long)(((unsigned long long)Benchmark_Characters * 1000000) / Time_Taken);
+
+} // end of function
+
+
+// ------------------------------------------------------------------------------
+// Characters per second, rotated font writer against the bit at a time reference
+// ------------------------------------------------------------------------------
+template <class Matrix> void Benchmark_Write_Character(Matrix &Display) {
+
+  unsigned long Before = Benchmark_Character_Writer(Display, true);
+  unsigned long After = Benchmark_Character_Writer(Display, false);
+
+  Serial.print("Write_Character bitwise "); Serial.print(Before); Serial.print(" chars/s, rotated ");
+  Serial.print(After); Serial.println(" chars/s");
+
+  Display.Clear_Buffer();
+
+} // end of function
+
+
+// -----------------------------------------------------------------------------------------------
+// Full display refreshes per second, each transaction sent as one block against a byte at a time
+// -----------------------------------------------------------------------------------------------
+template <class Matrix> unsigned long Benchmark_Refresh_Rate(Matrix &Display, bool Bulk) {
+
+  Display.Bulk_Transfer = Bulk;
+
+  unsigned long Start = micros();
+
+  for (int i = 0; i < Benchmark_Refreshes; i++) {
+    Display.Display_Refresh();
+  } // end of loop
+
+  unsigned long Time_Taken = micros() - Start;
+  if (Time_Taken == 0) {
+    Time_Taken = 1;
+  }
+
+  Display.Bulk_Transfer = true;
+
+  return (unsigned long)(((unsigned long long)Benchmark_Refreshes * 1000000) / Time_Taken);
+
+} // end of function
+
+
+template <class Matrix> void Benchmark_Transfer(Matrix &Display) {
+
+  unsigned long Before = Benchmark_Refresh_Rate(Display, false);
+  unsigned long After = Benchmark_Refresh_Rate(Display, true);
+
+  Serial.print("Display_Refresh byte at a time "); Serial.print(Before); Serial.print(" frames/s, block ");
+  Serial.print(After); Serial.println(" frames/s");
+
+} // end of function
+
+
+// ------------------------------------------------------------------------------------------------------------
+// Reference graphics, a pixel at a time through Pixel_Get and Pixel_Set. The baseline for the graphics benchmark
+// and what the word versions must match
+// ------------------------------------------------------------------------------------------------------------
+template <class Matrix> void Fill_Rect_Pixelwise(Matrix &Display, int X, int Y, int Width, int Height, uint8_t Colour) {
+
+  for (int yy = Y; yy < Y + Height; yy++) {
+    for (int xx = X; xx < X + Width; xx++) {
+      if (xx >= 0 && xx < Matrix::Columns && yy >= 0 && yy < Matrix::Height) {
+        Display.Pixel_Set(xx, yy, (Colour == Pixel_Invert) ? !Display.Pixel_Get(xx, yy) : (Colour == Pixel_On));
+      }
+    }
+  } // end of row loop
+
+} // end of function
+
+
+template <class Matrix> void Invert_Buffer_Pixelwise(Matrix &Display) {
+
+  Fill_Rect_Pixelwise(Display, 0, 0, Matrix::Columns, Matrix::Height, Pixel_Invert);
+
+} // end of function
+
+
+template <class Matrix> void Scroll_Buffer_Up_Pixelwise(Matrix &Display, int Count) {
+
+  for (int yy = 0; yy < Matrix::Height; yy++) {
+    for (int xx = 0; xx < Matrix::Columns; xx++) {
+      Display.Pixel_Set(xx, yy, (yy + Count < Matrix::Height) ? Display.Pixel_Get(xx, yy + Count) : false);
+    }
+  } // end of row loop
+
+} // end of function
+
+
+template <class Matrix> void Draw_Sprite_Pixelwise(Matrix &Display, int X, int Y, const uint8_t *Image, const uint8_t *Mask, int Width, int Height) {
+
+  int Row_Bytes = (Width + 7) / 8;
+
+  for (int yy = 0; yy < Height; yy++) {
+    for (int xx = 0; xx < Width; xx++) {
+      bool Lit = bitRead(Image[(yy * Row_Bytes) + (xx / 8)], xx % 8) == 1;
+      bool Drawn = (Mask != NULL) ? (bitRead(Mask[(yy * Row_Bytes) + (xx / 8)], xx % 8) == 1) : Lit;
+      if (Drawn == true && X + xx >= 0 && X + xx < Matrix::Columns && Y + yy >= 0 && Y + yy < Matrix::Height) {
+        Display.Pixel_Set(X + xx, Y + yy, Lit);
+      }
+    }
+  } // end of row loop
+
+} // end of function
+
+
+// ----------------------------------------------------------------------------------------------------------------
+// Time Benchmark_Graphics_Ops of a graphics operation, each on the frame buffer the one before left, returns uS per
+// operation. Which picks the operation, Word the word version or the pixel at a time reference
+// ----------------------------------------------------------------------------------------------------------------
+#define Benchmark_Graphics_Fill   0
+#define Benchmark_Graphics_Invert 1
+#define Benchmark_Graphics_Scroll 2
+#define Benchmark_Graphics_Sprite 3
+
+const char *const Benchmark_Graphics_Names[4] = { "Fill_Rect", "Invert_Buffer", "Scroll_Buffer_Up", "Draw_Sprite" };
+
+const uint8_t Benchmark_Sprite[24] = { 0x3C, 0x00, 0x42, 0x00, 0x81, 0x01, 0xA5, 0x01, 0x81, 0x01, 0x99, 0x01,
+                                       0x42, 0x00, 0x3C, 0x00, 0xFF, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0x01 };
+
+template <class Matrix> void Benchmark_Graphics_Op(Matrix &Display, uint8_t Which, bool Word, int i) {
+
+  switch (Which) {
+    case Benchmark_Graphics_Fill:
+      if (Word == true) {
+        Display.Fill_Rect((i % 7) - 2, (i % 5) - 1, Matrix::Columns - (i % 9), Matrix::Height - (i % 3), (uint8_t)(i % 3));
+      }
+      else {
+        Fill_Rect_Pixelwise(Display, (i % 7) - 2, (i % 5) - 1, Matrix::Columns - (i % 9), Matrix::Height - (i % 3), (uint8_t)(i % 3));
+      }
+      break;
+    case Benchmark_Graphics_Invert:
+      if (Word == true) {
+        Display.Invert_Buffer();
+      }
+      else {
+        Invert_Buffer_Pixelwise(Display);
+      }
+      break;
+    case Benchmark_Graphics_Scroll:
+      if (Word == true) {
+        Display.Scroll_Buffer_Up(1 + (i % 5));
+      }
+      else {
+        Scroll_Buffer_Up_Pixelwise(Display, 1 + (i % 5));
+      }
+      break;
+    default:
+      if (Word == true) {
+        Display.Draw_Sprite((i % Matrix::Columns) - 4, (i % Matrix::Height) - 4, Benchmark_Sprite, NULL, 9, 12);
+      }
+      else {
+        Draw_Sprite_Pixelwise(Display, (i % Matrix::Columns) - 4, (i % Matrix::Height) - 4, Benchmark_Sprite, NULL, 9, 12);
+      }
+      break;
+  } // end of switch
+
+} // end of function
+
+
+template <class Matrix> unsigned long Benchmark_Graphics_Time(Matrix &Display, uint8_t Which, bool Word) {
+
+  unsigned long Start = micros();
+
+  for (int i = 0; i < Benchmark_Graphics_Ops; i++) {
+    Benchmark_Graphics_Op(Display, Which, Word, i);
+  } // end of loop
+
+  unsigned long Time_Taken = micros() - Start;
+
+  return Time_Taken / Benchmark_Graphics_Ops;
+
+} // end of function
+
+
+// ------------------------------------------------------------------------------------
+// uS per operation of the word graphics against the pixel at a time reference
+// ------------------------------------------------------------------------------------
+template <class Matrix> void Benchmark_Graphics(Matrix &Display) {
+
+  for (uint8_t Which = 0; Which < 4; Which++) {
+    unsigned long Before = Benchmark_Graphics_Time(Display, Which, false);
+    unsigned long After = Benchmark_Graphics_Time(Display, Which, true);
+    Serial.print(Benchmark_Graphics_Names[Which]); Serial.print(" pixelwise "); Serial.print(Before); Serial.print(" uS, word ");
+    Serial.print(After); Serial.println(" uS");
+  } // end of loop
+
+  Display.Clear_Buffer();
+
+} // end of function
+
+
+// -------------------
+// Run all benchmarks
+// -------------------
+template <class Matrix> void Benchmark_Run(Matrix &Display) {
+
+  Benchmark_Write_Character(Display);
+  Benchmark_Transfer(Display);
+  Benchmark_Graphics(Display);
+
+} // end of function
@@ -12,14 +12,6 @@
        Select in software
 */
 
-// --------------------------------------------------------------------------------------
-// Global variables
-// --------------------------------------------------------------------------------------
-
-// MAX7219 items
-#define Number_MAX7219 4                         // Number of MAX7219 chips present
-#define MAX7219_CS  10                             // Pin used for CS. 7=UNO 15=ESP8266
-
 // 90 Deg Font library
 #include "Font_90_Degrees.h"
 
@@ -31,15 +23,242 @@
 #define MAX7219_Shutdown      0xC
 #define MAX7219_Displaytest   0xF
 
+// Control register shadow items
+#define MAX7219_Control_Registers 5               // DecodeMode, Intensity, ScanLimit, Shutdown and Displaytest
+#define MAX7219_Resync_Steps 13                   // Registers re-sent by the re-sync, the control registers then digits 1 to 8
+
 // Display items
-#define Space_Width 4                             // How wide the space should be 0-8
-int Column = 0;                                   // Column address for character
-uint8_t Frame_Buffer[Number_MAX7219 * 8];         // Frame buffer array
-bool Scrolling = false;
-int Scroll_Position = 0;
-String Message_Text = "";                         // Message to display
-int Scroll_Speed = 0;
-// --------------------------------------------------------------------------------------
+#define Space_Width 4                             // How wide the space should be 0-8, used by proportional text
+
+// Animation items, effects are run one frame at a time from Animation_Tick()
+#define Effect_None       0                       // No effect running
+#define Effect_Scroll     1                       // Scroll text right to left
+#define Effect_Wipe_Left  2                       // Wipe text in from the right
+#define Effect_Wipe_Right 3                       // Wipe text in from the left
+#define Effect_Wipe_Fill  4                       // Second part of the wipe right, fill the rest with spaces
+#define Effect_Hold       5                       // Show text at column 0 and hold it, Speed is the hold time in mS
+#define Effect_Slide_Up   6                       // Slide a picture in from the bottom, pushing the frame out of the top
+#define Effect_Slide_Down 7                       // Slide a picture in from the top, pushing the frame out of the bottom
+#define Effect_Dissolve   8                       // Change to a picture a few pixels at a time, in an ordered dither
+#define Effect_Roll       9                       // Roll the changed cells of a counter up to their new characters
+
+// Drawing items, what a drawing function does to the pixels it covers
+#define Pixel_Off    0
+#define Pixel_On     1
+#define Pixel_Invert 2
+
+// The graphics work on 32 bit words of 4 frame buffer bytes, 4 rows of a module, byte 0 the top row in the low byte
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__)
+#error "The graphics functions need a little endian processor"
+#endif
+
+// Message queue items
+#ifndef MAX7219_Queue_Size
+#define MAX7219_Queue_Size 4                      // Messages that can be waiting on each display
+#endif
+
+// Statistics items, define MAX7219_STATS before including this file to time the hot paths and count the wire
+// activity, see MAX7219_Stats. Without it the statistics compile to nothing
+#ifdef MAX7219_STATS
+#define MAX7219_Stats_Start(Timer) unsigned long Timer = micros()
+#define MAX7219_Stats_Time(Stage, Timer) Stats.Stage.Add(micros() - Timer)
+#define MAX7219_Stats_Count(Item, Amount) Stats.Item += (Amount)
+#else
+#define MAX7219_Stats_Start(Timer)
+#define MAX7219_Stats_Time(Stage, Timer)
+#define MAX7219_Stats_Count(Item, Amount)
+#endif
+
+// Tile orientations, how a module is turned in a tiled display. Tile_90 is the 90 degree module this demo is for, a
+// data register is a row and bit 0 the left most column. Tile_0 is a module with the matrix a quarter turn round from
+// that, a register is a column. Tile_180 and Tile_270 are the same two turned upside down
+#define Tile_0   0
+#define Tile_90  1
+#define Tile_180 2
+#define Tile_270 3
+
+// Stream items, frames sent from a PC over a serial port. Each frame is Stream_Sync, the type, the payload and a checksum,
+// the 8 bit sum of the type and payload bytes. A full frame's payload is the whole frame buffer. A delta frame's payload is
+// runs of changed frame buffer bytes, each a 3 byte header (offset low, offset high, count) and count bytes, ended by a
+// header with a count of 0. Every frame is answered with Stream_Ack once shown or Stream_Nak, send a full frame
+#define Stream_Sync        0xA5                   // Start of a frame
+#define Stream_Full_Frame  'F'                    // The whole frame buffer follows
+#define Stream_Delta_Frame 'D'                    // Runs of changed frame buffer bytes follow
+#define Stream_Ack         0x06                   // Frame shown, send the next one
+#define Stream_Nak         0x15                   // Frame bad, or a delta with no whole frame to apply it to, send a full frame
+
+// Stream receive states
+#define Stream_Wait_Sync   0
+#define Stream_Wait_Type   1
+#define Stream_Run_Header  2
+#define Stream_Data        3
+#define Stream_Checksum    4
+
+// Counter items
+#ifndef MAX7219_Counter_Cells
+#define MAX7219_Counter_Cells 8                   // Characters a counter can show, "12:34:56" is 8
+#endif
+
+// Zone items
+#ifndef MAX7219_Zones
+#define MAX7219_Zones 3                           // Zones each display can be split into, each runs its own effect
+#endif
+
+
+// --------------------------------------------------------------------------------------------------------------
+// Transport, all MAX7219 communications go through these functions. The default is the SPI port and CS pin
+// Swap them with MAX7219_Set_Transport to drive the chain some other way, the host build uses a simulated chain
+// All displays share the transport, each is selected by its own CS pin, unless a display is given its own transport
+// with Own_Transport, MAX7219_Parallel_Transport for one display while the others stay on the SPI port
+// Transfer_Block sends a whole transaction in one go, it may start the transfer and return before it is done (DMA)
+// in which case Deselect must wait for it to finish. The block may be overwritten (AVR SPI.transfer reads back into it)
+// Set Transfer_Block to NULL if the transport can only send a byte at a time
+// Transfer_Lanes clocks several chains at once, each on its own DIN line, for displays split into chains. Lane k, the
+// k'th chain from the left, is the Length bytes at Data + ((Lanes - 1 - k) * Length). NULL if the transport has one DIN
+// --------------------------------------------------------------------------------------------------------------
+struct MAX7219_Transport {
+  void (*Select)(uint8_t Cs_Pin);                 // Start a transaction, take CS low
+  void (*Transfer)(uint8_t Data);                 // Send one byte down the chain
+  void (*Deselect)(uint8_t Cs_Pin);               // End a transaction, take CS high and the chips latch
+  void (*Transfer_Block)(uint8_t *Data, uint16_t Length); // Send a block of bytes down the chain
+  void (*Transfer_Lanes)(uint8_t *Data, uint16_t Length, uint8_t Lanes); // Send a block down each of several chains together
+};
+
+void SPI_Select(uint8_t Cs_Pin) {
+  digitalWrite(Cs_Pin, LOW);
+}
+
+void SPI_Transfer(uint8_t Data) {
+  SPI.transfer(Data);
+}
+
+void SPI_Deselect(uint8_t Cs_Pin) {
+  digitalWrite(Cs_Pin, HIGH);
+}
+
+void SPI_Transfer_Block(uint8_t *Data, uint16_t Length) {
+#if defined(ESP8266) || defined(ESP32)
+  SPI.writeBytes(Data, Length);                   // Fills the SPI FIFO, nothing is read back
+#else
+  SPI.transfer(Data, Length);
+#endif
+}
+
+MAX7219_Transport Transport = { SPI_Select, SPI_Transfer, SPI_Deselect, SPI_Transfer_Block, NULL };
+
+
+// ----------------------------------------------------------------------------------------------------------------
+// Parallel transport, chains sharing CS and CLK with a DIN pin each, clocked together in software. A display split
+// into Chains chains then takes the clock pulses of one chain of Chips / Chains chips. Set the pins with
+// MAX7219_Parallel_Pins, DIN pin k drives the k'th chain from the left, none of them may be a hardware SPI pin.
+// The pins are written straight to their port registers, with the DIN pins all on one port a bit of every lane goes
+// out in one write. A bit still costs several times a hardware SPI bit, see the README. Nothing on these ports may be
+// changed from an interrupt, the port writes are read, modify, write
+// A transfer with more lanes than DIN pins set is not sent, Parallel_Refused counts them
+// ----------------------------------------------------------------------------------------------------------------
+#ifndef MAX7219_Lanes_Max
+#define MAX7219_Lanes_Max 8                       // Most DIN pins the parallel transport can drive
+#endif
+
+#if defined(__AVR__)
+typedef uint8_t MAX7219_Port_Bits;                // Width of a port output register
+#else
+typedef uint32_t MAX7219_Port_Bits;
+#endif
+
+volatile MAX7219_Port_Bits *Parallel_Clock_Port = NULL;
+MAX7219_Port_Bits Parallel_Clock_Mask = 0;
+volatile MAX7219_Port_Bits *Parallel_Din_Port[MAX7219_Lanes_Max] = {};
+MAX7219_Port_Bits Parallel_Din_Mask[MAX7219_Lanes_Max] = {};
+MAX7219_Port_Bits Parallel_Din_All = 0;           // Every DIN pin's bit, when they are all on one port, 0 if not
+uint8_t Parallel_Lanes = 0;
+unsigned long Parallel_Refused = 0;               // Transfers not sent as they had more lanes than there are DIN pins
+
+void MAX7219_Parallel_Pins(uint8_t Clock_Pin, const uint8_t *Din_Pins, uint8_t Lanes) {
+
+  Parallel_Lanes = (Lanes > MAX7219_Lanes_Max) ? MAX7219_Lanes_Max : Lanes;
+
+  pinMode(Clock_Pin, OUTPUT);
+  digitalWrite(Clock_Pin, LOW);
+  Parallel_Clock_Port = portOutputRegister(digitalPinToPort(Clock_Pin));
+  Parallel_Clock_Mask = digitalPinToBitMask(Clock_Pin);
+
+  Parallel_Din_All = 0;
+  for (uint8_t k = 0; k < Parallel_Lanes; k++) {
+    pinMode(Din_Pins[k], OUTPUT);
+    Parallel_Din_Port[k] = portOutputRegister(digitalPinToPort(Din_Pins[k]));
+    Parallel_Din_Mask[k] = digitalPinToBitMask(Din_Pins[k]);
+    Parallel_Din_All |= Parallel_Din_Mask[k];
+  } // end of loop
+
+  for (uint8_t k = 1; k < Parallel_Lanes; k++) {
+    if (Parallel_Din_Port[k] != Parallel_Din_Port[0]) {
+      Parallel_Din_All = 0;
+    }
+  } // end of loop
+
+}
+
+void Parallel_Transfer_Lanes(uint8_t *Data, uint16_t Length, uint8_t Lanes) {
+
+  // A lane without a DIN pin would leave its chain as it was, with nothing to say so
+  if (Lanes > Parallel_Lanes) {
+    Parallel_Refused++;
+    return;
+  }
+
+  // MSB first, DIN is set with CLK low and the chips take it on the rising edge
+  for (uint16_t i = 0; i < Length; i++) {
+    for (int8_t Bit = 7; Bit >= 0; Bit--) {
+
+      // All the DIN pins on one port, one write
+      if (Parallel_Din_All != 0) {
+        MAX7219_Port_Bits Bits = 0;
+        for (uint8_t k = 0; k < Lanes; k++) {
+          if (bitRead(Data[((Lanes - 1 - k) * Length) + i], Bit) == 1) {
+            Bits |= Parallel_Din_Mask[k];
+          }
+        } // end of lane loop
+        *Parallel_Din_Port[0] = (*Parallel_Din_Port[0] & ~Parallel_Din_All) | Bits;
+      }
+      else {
+        for (uint8_t k = 0; k < Lanes; k++) {
+          if (bitRead(Data[((Lanes - 1 - k) * Length) + i], Bit) == 1) {
+            *Parallel_Din_Port[k] |= Parallel_Din_Mask[k];
+          }
+          else {
+            *Parallel_Din_Port[k] &= ~Parallel_Din_Mask[k];
+          }
+        } // end of lane loop
+      }
+
+      *Parallel_Clock_Port |= Parallel_Clock_Mask;
+      *Parallel_Clock_Port &= ~Parallel_Clock_Mask;
+
+    } // end of bit loop
+  } // end of byte loop
+
+}
+
+void Parallel_Transfer_Block(uint8_t *Data, uint16_t Length) {
+  Parallel_Transfer_Lanes(Data, Length, 1);      // One chain, on the first DIN pin
+}
+
+void Parallel_Transfer(uint8_t Data) {
+  Parallel_Transfer_Lanes(&Data, 1, 1);
+}
+
+const MAX7219_Transport MAX7219_Parallel_Transport = { SPI_Select, Parallel_Transfer, SPI_Deselect, Parallel_Transfer_Block, Parallel_Transfer_Lanes };
+
+
+// ------------------------------------------------------------
+// Change the transport used for all MAX7219 communications
+// ------------------------------------------------------------
+void MAX7219_Set_Transport(const MAX7219_Transport &New_Transport) {
+
+  Transport = New_Transport;
+
+} // end of function
 
 
 // --------------------------------------------------------------------------------------------------------
@@ -50,30 +269,643 @@ int Scroll_Speed = 0;
 void MAX7219_Register_Write(uint8_t Address, uint8_t Data) {
 
   // Send the register address
-  SPI.transfer(Address);
+  Transport.Transfer(Address);
 
   // Send the value
-  SPI.transfer(Data);
+  Transport.Transfer(Data);
+
+} // end of function
+
+
+// -----------------------------------------------------------------------------------------------
+// Control registers in the order they are held in the control shadow, see MAX7219_Control_Index
+// -----------------------------------------------------------------------------------------------
+const uint8_t MAX7219_Control_Address[MAX7219_Control_Registers] = { MAX7219_DecodeMode, MAX7219_Intensity, MAX7219_ScanLimit, MAX7219_Shutdown, MAX7219_Displaytest };
+
+
+// -----------------------------------------------------------------------------
+// Where a control register is held in the control shadow, -1 if not a control register
+// -----------------------------------------------------------------------------
+int8_t MAX7219_Control_Index(uint8_t Address) {
+
+  for (int8_t i = 0; i < MAX7219_Control_Registers; i++) {
+    if (MAX7219_Control_Address[i] == Address) {
+      return i;
+    }
+  } // end of loop
+
+  return -1;
+
+} // end of function
+
+
+// ---------------------------------------------------------------------------------------------------------------
+// Text used by the display, a pointer to a nul terminated string in RAM or flash (PROGMEM, F()), nothing is copied
+// Text for an effect or the queue must stay put until the display has finished with it
+// ---------------------------------------------------------------------------------------------------------------
+struct MAX7219_Text {
+  const char *Text;                               // First character
+  bool Flash;                                     // true, Text is in flash and read with pgm_read_byte
+
+  MAX7219_Text(const char *Ram_Text = "") : Text(Ram_Text), Flash(false) {}
+  MAX7219_Text(const __FlashStringHelper *Flash_Text) : Text((const char *)Flash_Text), Flash(true) {}
+
+  // Character at Index, 0 at the end of the text
+  char charAt(unsigned int Index) const {
+    return (Flash == true) ? (char)pgm_read_byte(Text + Index) : Text[Index];
+  }
+};
+
+
+// ----------------------------------------------------------------
+// A queued message, the text and the effect to show it with
+// ----------------------------------------------------------------
+struct MAX7219_Message {
+  MAX7219_Text Text;
+  uint8_t Effect;                                 // Effect_Scroll, Effect_Wipe_Left, Effect_Wipe_Right or Effect_Hold
+  int Speed;                                      // Effect speed in mS per frame, hold time in mS for Effect_Hold
+};
+
+
+#ifdef MAX7219_STATS
+// ----------------------------------------------------------
+// Times of one stage of the work, min, max and total in uS
+// ----------------------------------------------------------
+struct MAX7219_Stage {
+  unsigned long Count = 0;                        // Times the stage ran
+  unsigned long Total = 0;
+  unsigned long Min = 0;
+  unsigned long Max = 0;
+
+  void Add(unsigned long Time) {
+    if (Count == 0 || Time < Min) {
+      Min = Time;
+    }
+    if (Time > Max) {
+      Max = Time;
+    }
+    Total += Time;
+    Count++;
+  }
+
+  unsigned long Average() const {
+    return (Count == 0) ? 0 : Total / Count;
+  }
+};
+
+
+// -------------------------------------------------------------------------------------------------------------
+// Statistics for one display, since the last Stats_Reset. Only there when MAX7219_STATS is defined
+// -------------------------------------------------------------------------------------------------------------
+struct MAX7219_Stats {
+  MAX7219_Stage Character;                        // Write_Character
+  MAX7219_Stage Send;                             // Wire_Send, one transaction down the chain
+  MAX7219_Stage Update;                           // Display_Update, compare with the shadow and send
+  MAX7219_Stage Render;                           // Drawing one effect frame into the frame buffer
+  MAX7219_Stage Frame_Interval;                   // Time from one animation frame sent to the next, the achieved frame period
+  MAX7219_Stage Requested_Period;                 // Time between the due times of the frames Frame_Interval is sampled on
+  unsigned long Frames = 0;                       // Animation frames sent, one for each Display_Update from Animation_Tick
+  unsigned long Bytes = 0;                        // Bytes sent to the chain
+  unsigned long Transactions = 0;                 // CS low to CS high cycles
+  unsigned long Late_Frames = 0;                  // Frames drawn more than half a frame period after they were due
+  unsigned long Dropped_Frames = 0;               // Frames skipped as they were late
+  unsigned long Last_Frame = 0;                   // micros() value when the last animation frame was sent
+  unsigned long Last_Due = 0;                     // micros() value the last animation frame sent was due at
+  bool Last_Frame_Valid = false;                  // false, no frame sent since an effect started
+  unsigned long Report_Due = 0;                   // micros() value when the next report is due
+};
+#endif
+
+
+// -----------------------------------------------------------------------------
+// Reverse the bits of a byte, bit 0 becomes bit 7, used to turn a tile round
+// -----------------------------------------------------------------------------
+uint8_t MAX7219_Reverse_Bits(uint8_t Data) {
+
+  Data = (uint8_t)((Data >> 4) | (Data << 4));
+  Data = (uint8_t)(((Data & 0xCC) >> 2) | ((Data & 0x33) << 2));
+  Data = (uint8_t)(((Data & 0xAA) >> 1) | ((Data & 0x55) << 1));
+  return Data;
+
+} // end of function
+
+
+// -----------------------------------------------------------------------------
+// Bits First up to Last of a byte, clipped to the byte, bit 0 the left most column
+// -----------------------------------------------------------------------------
+uint8_t MAX7219_Bit_Mask(int First, int Last) {
+
+  if (First <= 0 && Last >= 8) {
+    return 0xFF;
+  }
+  if (First >= 8 || Last <= 0 || First >= Last) {
+    return 0x00;
+  }
+  if (First < 0) {
+    First = 0;
+  }
+  if (Last > 8) {
+    Last = 8;
+  }
+
+  return (uint8_t)(((1U << (Last - First)) - 1) << First);
+
+} // end of function
+
+
+// ------------------------------------------------------------------------------------------------------------
+// Rows First to Last of a module that fall in one of its words, Word 0 rows 0 to 3, Word 1 rows 4 to 7. Each
+// row is a byte lane of the word, the mask has 0xFF in the lanes of the rows
+// ------------------------------------------------------------------------------------------------------------
+uint32_t MAX7219_Lane_Mask(int First, int Last, uint8_t Word) {
+
+  First -= Word * 4;
+  Last -= Word * 4;
+  if (First < 0) {
+    First = 0;
+  }
+  if (Last > 3) {
+    Last = 3;
+  }
+  if (First > Last) {
+    return 0;
+  }
+
+  return (0xFFFFFFFFUL >> (8 * (3 - Last))) & (0xFFFFFFFFUL << (8 * First));
+
+} // end of function
+
+
+// -------------------------------------------------------------------
+// Load and store a word of 4 frame buffer bytes, any alignment
+// -------------------------------------------------------------------
+uint32_t MAX7219_Load_Word(const uint8_t *Data) {
+
+  uint32_t Word;
+  memcpy(&Word, Data, 4);
+  return Word;
+
+} // end of function
+
+void MAX7219_Store_Word(uint8_t *Data, uint32_t Word) {
+
+  memcpy(Data, &Word, 4);
+
+} // end of function
+
+
+// ------------------------------------------------------------------------
+// Draw the pixels of a word under the mask, Pixel_Off, Pixel_On or Pixel_Invert
+// ------------------------------------------------------------------------
+uint32_t MAX7219_Draw_Word(uint32_t Word, uint32_t Mask, uint8_t Colour) {
+
+  switch (Colour) {
+    case Pixel_Off: return Word & ~Mask;
+    case Pixel_On: return Word | Mask;
+    default: return Word ^ Mask;
+  } // end of switch
+
+} // end of function
+
+
+// ---------------------------------------------------------------------------------------------------------------
+// Order the pixels of a module change in for Effect_Dissolve, an 8 x 8 ordered dither. Row by row, one byte a column
+// A pixel changes on step (Order / 8) + 1 of 8, so each step changes 8 pixels spread over the module
+// ---------------------------------------------------------------------------------------------------------------
+const uint8_t MAX7219_Dissolve_Order[64] PROGMEM = {
+   0, 32,  8, 40,  2, 34, 10, 42,
+  48, 16, 56, 24, 50, 18, 58, 26,
+  12, 44,  4, 36, 14, 46,  6, 38,
+  60, 28, 52, 20, 62, 30, 54, 22,
+   3, 35, 11, 43,  1, 33,  9, 41,
+  51, 19, 59, 27, 49, 17, 57, 25,
+  15, 47,  7, 39, 13, 45,  5, 37,
+  63, 31, 55, 23, 61, 29, 53, 21
+};
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// A zone, a run of columns of the display with its own text and effect. Effects in a zone only draw inside its columns
+// Zone 0 is the whole display until the zones are defined, the others have no columns
+// ---------------------------------------------------------------------------------------------------------------------
+struct MAX7219_Zone {
+  int Start = 0;                                  // First column of the zone
+  int Width = 0;                                  // Columns in the zone, 0 the zone is not used
+  int Band = 0;                                   // Row of modules the zone is in, 0 the top
+
+  // Text items
+  int Scroll_Position = 0;                        // Column of the zone the message starts at
+  MAX7219_Text Message_Text;                      // Message to display
+  int Message_Width = 0;                          // Width of the message in columns
+
+  // Message cursor, the character Message_Column last found and the message column it starts at
+  unsigned int Cursor_Index = 0;
+  int Cursor_Column = 0;
+
+  // Column strip items, the scroll message rendered once into a buffer supplied by Strip_Attach, same layout as the
+  // frame buffer, 8 bytes (rows) for each 8 columns. Each scroll frame is then a copy of a window of the strip
+  uint8_t *Strip = NULL;                          // Strip buffer, NULL the message is rendered every frame
+  int Strip_Size = 0;                             // Size of the strip buffer in bytes, holds that many columns
+  bool Strip_Ready = false;                       // true, the strip holds Strip_Text as rendered
+  MAX7219_Text Strip_Text;                        // Message in the strip, the strip is reused while the text is the same
+  bool Strip_Proportional = false;                // Proportional setting the strip was rendered with
+  int Strip_Period = 0;                           // Columns in the strip, the message width plus the marquee gap
+  bool Marquee = false;                           // true, the scroll loops for ever, the message repeats with no gap (needs a strip)
+  int Marquee_Gap = 0;                            // Blank columns between the end of the message and the start of the next
+
+  // Animation items
+  uint8_t Effect_Type = Effect_None;              // Effect currently running
+  int Effect_Position = 0;                        // Column of the zone the next wipe frame is written at
+  int Effect_Speed = 0;                           // Effect speed in mS per frame
+  unsigned long Frame_Period = 0;                 // Time from one frame to the next in uS
+  unsigned long Frame_Due = 0;                    // micros() value when the next frame is due
+  const uint8_t *Target = NULL;                   // Picture a transition changes to, frame buffer layout, see Transition_Start
+};
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// One display, a chain of Chips MAX7219's selected by Cs_Pin. Each display owns its frame buffer and effect state, so
+// several chains can be driven at once, each declared with its own size and CS pin, for example
+//   MAX7219_Matrix<4, 10> Display;
+// The chain length is known at compile time, every loop over the chips has a fixed count the compiler can unroll
+// A long display can be split into Chains equal chains, the frame buffer is still one display wide. Either each chain
+// has its own CS pin (Chain_Cs) on the shared DIN, and only chains with something to write are sent, or the chains
+// share CS and have a DIN each, sent together by a transport with Transfer_Lanes (MAX7219_Parallel_Transport)
+//   MAX7219_Matrix<32, 10, 4> Display;           // 32 chips as 4 chains of 8
+// The modules can be stacked in Rows rows of tiles, one 2D frame buffer of Columns by Height pixels. Where each chip sits
+// and how it is turned is set by Layout_Tiles or Layout_Chip and looked up when the frame is sent, see Map_Tile
+//   MAX7219_Matrix<8, 10, 1, 2> Display;         // 2 rows of 4 modules, 32 x 16 pixels
+// --------------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains = 1, int Rows = 1> class MAX7219_Matrix {
+  public:
+
+    static const int Tiles_X = Chips / Rows;      // Modules across each row
+    static const int Columns = Tiles_X * 8;       // Display width in columns
+    static const int Height = Rows * 8;           // Display height in pixels
+    static const int Buffer_Size = Chips * 8;     // Frame buffer size, 8 bytes (rows) for each module
+    static const int Chain_Chips = Chips / Chains; // Chips in each chain
+    static_assert((Chips % Chains) == 0, "The chips must split into equal chains");
+    static_assert((Chips % Rows) == 0, "The chips must split into equal rows");
+
+    MAX7219_Matrix() {
+      Zones[0].Width = Columns;                   // Zone 0 is the whole of the top row
+      for (int Chain = 0; Chain < Chains; Chain++) {
+        Chain_Cs[Chain] = Cs_Pin;
+      } // end of loop
+      Layout_Tiles();
+    }
+
+    // Display items
+    int Column = 0;                               // Column address for character
+    alignas(4) uint8_t Frame_Buffer[Buffer_Size] = {}; // Frame buffer array, the tiles left to right then top to bottom
+    bool Scroll_Incremental = true;               // true, scroll by shifting the frame buffer. false, write the whole message each frame
+    bool Proportional = false;                    // true, characters are as wide as their glyph plus a one column gap. false, 8 columns each
+
+    // Zone items, writes to the frame buffer only change the columns from Clip_Start up to Clip_End
+    MAX7219_Zone Zones[MAX7219_Zones];
+    int Clip_Start = 0;                           // First column that can be written
+    int Clip_End = Columns;                       // One past the last column that can be written
+    int Band_Base = 0;                            // Frame buffer offset of the row of modules text is written to
+
+    // Message queue, messages waiting for the one showing to finish. A ring, no heap is used
+    MAX7219_Message Message_Queue[MAX7219_Queue_Size];
+    uint8_t Queue_Head = 0;                       // Next message to show
+    uint8_t Queue_Count = 0;                      // Messages waiting
+
+    // Display shadow items, what the MAX7219's hold, used to only send registers that have changed
+    uint8_t Display_Shadow[Buffer_Size] = {};     // Copy of the data registers as held by the MAX7219's, chip x register r at (x * 8) + (8 - r)
+    uint8_t Dirty_Registers[Chips] = {};          // One byte per chip, bit (r - 1) set when data register r needs writing
+    bool Shadow_Valid = false;                    // False until the shadow matches the display, after power up or MAX7219_Init
+
+    // Control shadow items, what each chip's control registers hold, used to skip writes that would change nothing
+    uint8_t Control_Shadow[Chips][MAX7219_Control_Registers] = {};
+    bool Control_Valid = false;                   // False until MAX7219_Init has written the control registers
+
+    // Re-sync items, every Resync_Period one register is sent again to every chip from the shadows, so a chip upset by
+    // noise (blank, stuck in display test, lost digits) is put right within MAX7219_Resync_Steps periods
+    unsigned long Resync_Period = 0;              // Time from one re-sync step to the next in uS, 0 no re-sync
+    unsigned long Resync_Due = 0;                 // micros() value when the next re-sync step is due
+    uint8_t Resync_Register = 0;                  // Next register to re-sync, 0 to 4 control registers, 5 to 12 digits 1 to 8
+
+    // Animation items
+    bool Drop_Late_Frames = true;                 // true, skip frames when late. false, catch up showing every frame
+    unsigned long Dropped_Frames = 0;             // Count of frames skipped as they were late
+
+    // Wire items, each transaction is built as address/data pairs in a wire buffer and then sent as one block
+    // There are two buffers, the next transaction is built in one while the other is still being sent
+    uint8_t Wire_Buffer[2][Chips * 2];            // First pair sent ends up in the last chip (far right)
+    uint8_t Wire_Index = 0;                       // Wire buffer the next transaction is built in
+    bool Wire_Open = false;                       // True while a transaction is being sent, CS is still low
+    bool Bulk_Transfer = true;                    // true, send each transaction as one block. false, a byte at a time
+    uint8_t Wire_Cs = Cs_Pin;                     // CS pin of the open transaction
+
+    // Chain items, the wire buffer holds the chains one after the other, the far right chain first, so a chip has the same
+    // place in it however the display is split. Chain_Cs is only used when the transport has no Transfer_Lanes
+    uint8_t Chain_Cs[Chains];                     // CS pin of each chain from the left, all Cs_Pin unless set
+    const MAX7219_Transport *Own_Transport = NULL; // Transport for this display alone, NULL the shared Transport
+
+    // Tile items, the layout looked up for each chip in the chain, chip 0 is the first from DIN. Set once by Layout_Tiles
+    // or Layout_Chip, the writes to the frame buffer never look at them
+    uint16_t Tile_Offset[Chips];                  // Frame buffer offset of the tile the chip shows
+    uint8_t Tile_Orientation[Chips];              // Tile_0, Tile_90, Tile_180 or Tile_270
+
+    // Stream items, frames from a PC decoded straight into the frame buffer, see Stream_Start. The chips and their shadow are
+    // the front buffer, a frame is only sent to them once the whole of it has arrived and the checksum is right
+    Stream *Stream_Port = NULL;                   // Port the frames come in on, NULL not streaming
+    uint8_t Stream_State = Stream_Wait_Sync;
+    uint8_t Stream_Type = 0;                      // Stream_Full_Frame or Stream_Delta_Frame being received
+    uint8_t Stream_Sum = 0;                       // Sum of the type and payload bytes so far
+    uint8_t Stream_Header = 0;                    // Bytes of the run header received
+    unsigned int Stream_Offset = 0;               // Frame buffer offset the next byte goes to
+    unsigned int Stream_Remaining = 0;            // Bytes left in the full frame or the run
+    bool Stream_Bad = false;                      // The frame will be refused, a run off the frame buffer or no whole frame yet
+    bool Stream_Need_Full = true;                 // The frame buffer does not hold a whole frame, deltas are refused
+    bool Stream_Ack_Pending = false;              // A frame has been shown, its ACK is held back until Stream_Ack_Due
+    unsigned long Stream_Ack_Due = 0;             // micros() value the ACK can be sent
+    unsigned long Stream_Last_Byte = 0;           // micros() value a byte last came in
+    unsigned long Stream_Frame_Period = 0;        // Least time from one frame shown to the next in uS, 0 as fast as they come
+    unsigned long Stream_Timeout = 100000;        // A frame stopping part way for this long in uS is dropped and NAK'ed
+    unsigned long Stream_Frames = 0;              // Frames shown
+    unsigned long Stream_Errors = 0;              // Frames NAK'ed
+
+    // Counter items, a clock or counter in a zone, a row of character cells each redrawn only when its character changes,
+    // see Counter_Start. The digits are drawn from glyphs rendered once, the other characters from the font
+    uint8_t Counter_Zone = 0;                     // Zone the counter is in
+    int Counter_Location = 0;                     // Column of the zone the first cell starts at
+    int Counter_Roll_Speed = 0;                   // mS per frame of the rolling cells, 0 changed cells are drawn straight away
+    uint8_t Counter_Length = 0;                   // Cells drawn, 0 none, the next Counter_Show draws the whole zone
+    char Counter_Text[MAX7219_Counter_Cells];     // Character each cell shows, or is rolling to
+    char Counter_Old[MAX7219_Counter_Cells];      // Character each cell is rolling from, the same as Counter_Text when still
+    int Counter_Column[MAX7219_Counter_Cells];    // Display column each cell starts at
+    uint8_t Counter_Digit_Width = 8;              // Columns every digit cell takes, the widest digit so the digits never move
+    uint8_t Counter_Glyphs[10][8];                // Digits 0 to 9 as drawn, one byte a row, bit 0 the left most column of the cell
+
+#ifdef MAX7219_STATS
+    // Statistics items
+    MAX7219_Stats Stats;
+    unsigned long Stats_Report_Period = 0;        // Time from one report over Serial to the next in mS, 0 no reports
+#endif
+
+    // Chip communications
+    const MAX7219_Transport &Display_Transport();
+    void Wire_Transfer(uint8_t *Wire, uint16_t Length);
+    void Wire_Send();
+    void Wire_Finish();
+    void MAX7219_All_Chips(uint8_t Address, uint8_t Data);
+    void MAX7219_Init();
+    void Resync_Step();
+
+    // Frame buffer to display
+    void Mark_Dirty_Registers();
+    void Mark_Dirty_Chip(int Chip);
+    void Display_Flush();
+    void Display_Update();
+    void Display_Update_Region(int First_Column, int End_Column, uint8_t Band = 0);
+    void Display_Refresh();
+    void Clear_Buffer();
+    void Clear_All();
+
+    // Tiled displays
+    void Layout_Tiles(bool Serpentine = false, uint8_t Orientation = Tile_90);
+    void Layout_Chip(int Chip, int Tile_X, int Tile_Y, uint8_t Orientation);
+    const uint8_t *Map_Tile(int Chip, uint8_t *Tile);
+    void Pixel_Set(int X, int Y, bool On);
+    bool Pixel_Get(int X, int Y);
+
+    // Graphics, on the whole frame buffer a word (4 rows of a module) at a time, the clip is not used
+    void Pixel_Draw(int X, int Y, uint8_t Colour);
+    void Fill_Rect(int X, int Y, int Width, int Height, uint8_t Colour);
+    void Draw_Rect(int X, int Y, int Width, int Height, uint8_t Colour);
+    void Draw_Line(int X0, int Y0, int X1, int Y1, uint8_t Colour);
+    void Draw_Sprite(int X, int Y, const uint8_t *Image, const uint8_t *Mask, int Width, int Height);
+    void Invert_Buffer();
+    void Scroll_Buffer_Up(int Count);
+    void Scroll_Buffer_Down(int Count);
+
+    // Zones
+    void Zone_Define(uint8_t Zone_Number, int Start, int Width, uint8_t Band = 0);
+    void Clip_To_Zone(uint8_t Zone_Number);
+    void Clip_Clear();
+    uint8_t Clip_Mask(int Chip);
+    void Clear_Clip();
+
+    // Column strip
+    void Strip_Attach(uint8_t Zone_Number, uint8_t *Buffer, int Size);
+    void Strip_Render(MAX7219_Zone &Zone);
+    uint8_t Strip_Row(MAX7219_Zone &Zone, int Text_Column, uint8_t Row);
+    void Strip_Blit(MAX7219_Zone &Zone);
+
+    // Text
+    uint8_t Character_Advance(int Ascii_Value);
+    int Text_Width(const MAX7219_Text &Text_Value);
+    void Load_Message(MAX7219_Zone &Zone, const MAX7219_Text &Text_Value);
+    uint8_t Message_Column(MAX7219_Zone &Zone, int Text_Column);
+    void Write_Character(int Ascii_Value);
+    void Scroll_Buffer_Left(uint8_t Column_Data);
+    void Write_Text(const MAX7219_Text &Text_Value);
+    void Display_Text(MAX7219_Text Text_Value, int Location, uint8_t Zone_Number = 0);
+
+    // Effects, each zone runs its own
+    void Animation_Stop(uint8_t Zone_Number = 0);
+    bool Animation_Running(uint8_t Zone_Number = 0);
+    bool Animation_Any_Running();
+    void Animation_Start(uint8_t Zone_Number, uint8_t Type, int Speed);
+    bool Effect_Frame(MAX7219_Zone &Zone, bool Show);
+    bool Effect_Last_Frame(MAX7219_Zone &Zone);
+    unsigned long Animation_Tick();
+    void Animation_Wait(uint8_t Zone_Number = 0);
+    void Wipe_Text_Left_Start(MAX7219_Text Text_Value, int Speed, uint8_t Zone_Number = 0);
+    void Wipe_Text_Left(MAX7219_Text Text_Value, int Speed, uint8_t Zone_Number = 0);
+    void Wipe_Text_Right_Start(MAX7219_Text Text_Value, int Speed, uint8_t Zone_Number = 0);
+    void Wipe_Text_Right(MAX7219_Text Text_Value, int Speed, uint8_t Zone_Number = 0);
+    void Hold_Text_Start(MAX7219_Text Text_Value, int Time, uint8_t Zone_Number = 0);
+    void Transition_Start(const uint8_t *Target, uint8_t Type, int Speed, uint8_t Zone_Number = 0);
+    void Slide_Step(MAX7219_Zone &Zone, uint8_t Step, bool Up);
+    void Dissolve_Step(MAX7219_Zone &Zone, uint8_t Step);
+    void Scroll_Update();
+    void Scroll_Text_Start(MAX7219_Text Text, int a, uint8_t Zone_Number = 0);
+
+#ifdef MAX7219_STATS
+    // Statistics
+    void Stats_Reset();
+    void Stats_Report();
+#endif
+
+    // Message queue, messages are shown in zone 0
+    bool Queue_Message(MAX7219_Text Text_Value, uint8_t Effect, int Speed);
+    uint8_t Queue_Pending();
+    void Queue_Clear();
+    void Start_Message(const MAX7219_Message &Message);
+
+    // Clock or counter, the cells that change are redrawn and only their modules sent
+    void Counter_Start(uint8_t Zone_Number = 0, int Location = 0, int Roll_Speed = 0);
+    void Counter_Show(MAX7219_Text Text_Value);
+    uint8_t Counter_Cell_Width(char Character);
+    const uint8_t *Counter_Glyph(char Character, uint8_t *Rows_Data);
+    void Counter_Draw_Cell(uint8_t Cell, const uint8_t *Rows_Data);
+    void Counter_Roll_Step(uint8_t Step);
+
+    // Streaming frames from a PC
+    void Stream_Start(Stream &Port);
+    void Stream_Stop();
+    bool Stream_Poll();
+    bool Stream_Byte(uint8_t Data);
+    void Stream_End_Frame(bool Good);
+    bool Stream_Ready();
+};
+
+
+// ------------------------------------------------------------------------------
+// The transport this display is sent with, its own or the one the displays share
+// ------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> const MAX7219_Transport &MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Display_Transport() {
+
+  return (Own_Transport != NULL) ? *Own_Transport : Transport;
+
+} // end of function
+
+
+// ----------------------------------------------------------------------------------------------------------------
+// Send the transaction built in the current wire buffer and move on to the other buffer for the next one
+// The previous transaction is ended first. This one is left open, so the next can be built while it is still
+// going out, call Wire_Finish to end it
+// ----------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Wire_Send() {
+
+  MAX7219_Stats_Start(Stats_Timer);
+
+  Wire_Finish();
+
+  uint8_t *Wire = Wire_Buffer[Wire_Index];
+  const MAX7219_Transport &Link = Display_Transport();
+
+  // One chain, or chains on their own DIN lines all sent together
+  if (Chains == 1 || Link.Transfer_Lanes != NULL) {
+
+    Link.Select(Cs_Pin);  // Take CS Low
+    Wire_Cs = Cs_Pin;
+    Wire_Open = true;
+    MAX7219_Stats_Count(Transactions, 1);
+
+    if (Chains == 1) {
+      Wire_Transfer(Wire, Chips * 2);
+    }
+    else {
+      Link.Transfer_Lanes(Wire, Chain_Chips * 2, Chains);
+      MAX7219_Stats_Count(Bytes, Chips * 2);
+    }
+
+  }
+
+  // Chains on their own CS pins, one after the other. A chain getting nothing but NOOP's is not sent
+  else {
+
+    for (int Chain = 0; Chain < Chains; Chain++) {
+
+      uint8_t *Lane = &Wire[(Chains - 1 - Chain) * Chain_Chips * 2];
+
+      bool Idle = true;
+      for (int i = 0; i < (Chain_Chips * 2); i += 2) {
+        if (Lane[i] != MAX7219_Noop) {
+          Idle = false;
+          break;
+        }
+      } // end of loop
+      if (Idle == true) {
+        continue;
+      }
+
+      Wire_Finish();
+      Link.Select(Chain_Cs[Chain]);  // Take this chains CS Low
+      Wire_Cs = Chain_Cs[Chain];
+      Wire_Open = true;
+      MAX7219_Stats_Count(Transactions, 1);
+
+      Wire_Transfer(Lane, Chain_Chips * 2);
+
+    } // end of chain loop
+
+  }
+
+  Wire_Index ^= 1;
+
+  MAX7219_Stats_Time(Send, Stats_Timer);
+
+} // end of function
+
+
+// --------------------------------------------------------------------------
+// Send bytes of the wire buffer down the selected chain, as one block if we can
+// --------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Wire_Transfer(uint8_t *Wire, uint16_t Length) {
+
+  const MAX7219_Transport &Link = Display_Transport();
+
+  if (Bulk_Transfer == true && Link.Transfer_Block != NULL) {
+    Link.Transfer_Block(Wire, Length);
+  }
+  else {
+    for (uint16_t i = 0; i < Length; i++) {
+      Link.Transfer(Wire[i]);
+    } // end of loop
+  }
+
+  MAX7219_Stats_Count(Bytes, Length);
+
+} // end of function
+
+
+// ------------------------------------------------------------------------
+// End the open transaction, CS high and the chips latch their registers
+// ------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Wire_Finish() {
+
+  if (Wire_Open == true) {
+    Display_Transport().Deselect(Wire_Cs);  // Take CS High
+    Wire_Open = false;
+  }
 
 } // end of function
 
 
 // -------------------------------------------------------------------------------------
 // Write data to all MAX7219 chips present, used to initialize display or set brightness
-// Writes one byte at a time to each of the MAX7219 chips present
+// Writes the same address and data to each of the MAX7219 chips present
 // -------------------------------------------------------------------------------------
-void MAX7219_All_Chips(uint8_t Address, uint8_t Data) {
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::MAX7219_All_Chips(uint8_t Address, uint8_t Data) {
+
+  // A control register every chip already holds is not sent again
+  int8_t Control_Index = MAX7219_Control_Index(Address);
+  if (Control_Index >= 0 && Control_Valid == true) {
+    bool Changed = false;
+    for (int i = 0; i < Chips; ++i) {
+      if (Control_Shadow[i][Control_Index] != Data) {
+        Changed = true;
+      }
+    } // end of loop
+    if (Changed == false) {
+      return;
+    }
+  }
 
-  digitalWrite(MAX7219_CS, LOW);  // Take CS Low
+  uint8_t *Wire = Wire_Buffer[Wire_Index];
 
-  for (uint8_t i = 0; i < Number_MAX7219; ++i) {
+  for (int i = 0; i < Chips; ++i) {
 
-    SPI.transfer(Address);    // Send the register address
-    SPI.transfer(Data);    // Send the value
+    *Wire++ = Address;    // Register address
+    *Wire++ = Data;       // Value
 
   } // end of loop
 
-  digitalWrite(MAX7219_CS, HIGH);  // Take CS High
+  Wire_Send();
+  Wire_Finish();
+
+  // Keep the control shadow in step
+  if (Control_Index >= 0) {
+    for (int i = 0; i < Chips; ++i) {
+      Control_Shadow[i][Control_Index] = Data;
+    } // end of loop
+  }
 
 } // end Function
 
@@ -81,7 +913,16 @@ void MAX7219_All_Chips(uint8_t Address, uint8_t Data) {
 // --------------------------------------------------------
 // Initialise the display, writing to all present MAX7219's
 // --------------------------------------------------------
-void MAX7219_Init() {
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::MAX7219_Init() {
+
+  // Every chain's CS pin idles high, a chain whose CS is never driven high never latches
+  for (int Chain = 0; Chain < Chains; Chain++) {
+    pinMode(Chain_Cs[Chain], OUTPUT);
+    digitalWrite(Chain_Cs[Chain], HIGH);
+  } // end of loop
+
+  // Chips may have lost their settings, send every control register whatever the shadow holds
+  Control_Valid = false;
 
   // Initialize all MAX7219 chips write to each present MAX7219 chip present
   MAX7219_All_Chips(MAX7219_DecodeMode, 0x00);
@@ -89,73 +930,212 @@ void MAX7219_Init() {
   MAX7219_All_Chips(MAX7219_ScanLimit, 0x07);
   MAX7219_All_Chips(MAX7219_Displaytest, 0x00);
   MAX7219_All_Chips(MAX7219_Shutdown, 0x01);
+  Control_Valid = true;
+
+  // Contents of the data registers are now unknown, next update must send them all
+  Shadow_Valid = false;
 
 } // end of function
 
 
-// ------------------------------------------------------------------------------------------------------------------------
-// Write data to display row (as display is rotated 90, a row is in fact a MAX7219 data register.
-// If the row number requested is greater than possible this function will do nothing.
-// Register_Address = Address
-// Register_Data = Data
-// So for a 12 chip display (range 0-95) Register_Address 95 (last address) is the last chips (far right) first register #1
-// and Address 0 is first chips (far left) last register #8. Got that?
-// ------------------------------------------------------------------------------------------------------------------------
-void Write_Row(uint8_t Register_Address, uint8_t Register_Data) {
+// -----------------------------------------------------------------------------------------------------------------
+// Send one register to every chip again, as the shadows say it should be, then move on to the next register
+// Steps through the control registers and then the digit registers, one transaction each, so the whole display is
+// re-sent every MAX7219_Resync_Steps calls. Registers whose shadow is not known yet are skipped
+// -----------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Resync_Step() {
+
+  uint8_t Step = Resync_Register;
+  Resync_Register = (Resync_Register + 1) % MAX7219_Resync_Steps;
+
+  uint8_t *Wire = Wire_Buffer[Wire_Index];
+
+  // Control register, loop from the last to the first chip (far right to far left)
+  if (Step < MAX7219_Control_Registers) {
+    if (Control_Valid == false) {
+      return;
+    }
+    for (int xx = Chips; xx-- > 0; ) {
+      *Wire++ = MAX7219_Control_Address[Step];
+      *Wire++ = Control_Shadow[xx][Step];
+    } // end of loop
+  }
+
+  // Digit register, from the display shadow, what the chips should already hold
+  else {
+    if (Shadow_Valid == false) {
+      return;
+    }
+    uint8_t Digit_Register = (Step - MAX7219_Control_Registers) + 1;
+    uint8_t Buffer_Offset = 8 - Digit_Register;
+    for (int xx = Chips; xx-- > 0; ) {
+      *Wire++ = Digit_Register;
+      *Wire++ = Display_Shadow[(xx * 8) + Buffer_Offset];
+    } // end of loop
+  }
+
+  Wire_Send();
+  Wire_Finish();
+
+} // end of function
+
+
+// -----------------------------------------------------------------------------------------------------------
+// Compare the frame buffer against the display shadow and mark any changed data registers as dirty
+// The shadow is brought up to the frame buffer as it goes, Display_Flush then sends the dirty registers from it
+// If the shadow is not valid (power up or after MAX7219_Init) every register is marked dirty
+// -----------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Mark_Dirty_Registers() {
+
+  for (int xx = 0; xx < Chips; xx++) {
+    Mark_Dirty_Chip(xx);
+  } // end of chip loop
+
+  Shadow_Valid = true;
+
+} // end of function
+
+
+// ------------------------------------------------------------------------------------------
+// Compare one chip's tile of the frame buffer against its shadow and mark its changed registers
+// ------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Mark_Dirty_Chip(int Chip) {
+
+  uint8_t Tile[8];
+  const uint8_t *Data = Map_Tile(Chip, Tile);
+  uint8_t *Shadow = &Display_Shadow[Chip * 8];
+
+  if (Shadow_Valid == false) {
+    Dirty_Registers[Chip] = 0xFF;
+  }
+  else {
+    for (uint8_t i = 0; i < 8; i++) {
+      if (Data[i] != Shadow[i]) {
+        bitSet(Dirty_Registers[Chip], 7 - i); // Buffer offset i is data register 8 - i
+      }
+    } // end of register loop
+  }
+
+  memcpy(Shadow, Data, 8);
 
+} // end of function
 
 
-  // Range check the address value
-  if (Register_Address >= 0 && Register_Address <= ((Number_MAX7219 * 8) - 1)) {
+// ----------------------------------------------------------------------------------------------------
+// Flush the dirty data registers to the display from the shadow, registers not marked dirty are not sent
+// Dirty registers sharing a register number are grouped into one transaction, clean chips get a NOOP
+// Each transaction is built while the one before it is still being sent
+// ----------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Display_Flush() {
 
-    // Range check passed. Which MAX7219 chip to write data to, write NOOP's to all others
-    // Chip_Number range 0 to number of chips, for a 12 chip display thats 0 to 11
-    int Chip_Number = Register_Address / 8;
+  for (uint8_t Digit_Register = 1; Digit_Register <= 8; Digit_Register++) {
 
-    // Find to chips data register to write data too, result is Row_Address. Range = 1 to 8 (data registers of the MAX7219
-    int xx = (Chip_Number * 8); Register_Address = 8 - (Register_Address - xx);
+    // Find how many chips need this register
+    int Dirty_Count = 0;
+    for (int xx = 0; xx < Chips; xx++) {
+      if (bitRead(Dirty_Registers[xx], Digit_Register - 1) == 1) {
+        Dirty_Count++;
+      }
+    } // end of loop
 
-    // Chip_Number = Calculated chip ID to write the data too (Number of MAX chips - 1) to 0
-    // Register_Address = Register within above chip (1-8)
+    // Nothing changed, skip the transaction
+    if (Dirty_Count == 0) {
+      continue;
+    }
 
-    // Start the transfer to the Max chips, loop through all MAX chips, writing either the data or NOOP
-    digitalWrite(MAX7219_CS, LOW);
+    uint8_t Buffer_Offset = 8 - Digit_Register;
+    uint8_t *Wire = Wire_Buffer[Wire_Index];
 
-    // Test which chip to write data too and write noop to all others, that is register address 0x00
     // Loop from the last to the first chip (far right to far left)
-    for (int xx = Number_MAX7219; xx-- > 0; ) {
-      // test if it the chip we are to write data to else write a NOOP
-      if (xx == Chip_Number) {
-        // This is the chip required, now select the column
-        MAX7219_Register_Write(Register_Address, Register_Data);
+    for (int xx = Chips; xx-- > 0; ) {
+      if (bitRead(Dirty_Registers[xx], Digit_Register - 1) == 1) {
+        *Wire++ = Digit_Register;
+        *Wire++ = Display_Shadow[(xx * 8) + Buffer_Offset];
+        bitClear(Dirty_Registers[xx], Digit_Register - 1);
       }
-      // else will write noop to other MAX7219 chips
+      // else will write noop to the unchanged MAX7219 chips
       else {
-        MAX7219_Register_Write(MAX7219_Noop, 0x00);
+        *Wire++ = MAX7219_Noop;
+        *Wire++ = 0x00;
       }
     } // end of loop
 
-    // CS high
-    digitalWrite(MAX7219_CS, HIGH);
+    Wire_Send();
 
-  } // end of range check
+  } // end of register loop
+
+  // CS high on the last transaction
+  Wire_Finish();
 
 } // end of function
 
 
 // ---------------------------------------------------------------------------------------
-// Update Display. Writes all the data from the display array into the MAX7219's registers
-// Starts at the far right, the last MAX7219 chip and at the last data register
-// Loops down through the array to the first byte in the array
-// With a 12 chip display the range for i is 95 to 0
+// Update Display. Writes the data from the display array into the MAX7219's registers
+// Only registers that differ from what the MAX7219's hold are sent, see Display_Flush
 // ---------------------------------------------------------------------------------------
-void Display_Update() {
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Display_Update() {
 
-  for (int i = ((Number_MAX7219 * 8) - 1); i > -1; i--) {
+  MAX7219_Stats_Start(Stats_Timer);
 
-    Write_Row(i, Frame_Buffer[i]); // Write to column, with data
+  Mark_Dirty_Registers();
+  Display_Flush();
 
-  } // end of loop
+  MAX7219_Stats_Time(Update, Stats_Timer);
+
+} // end of function
+
+
+// -----------------------------------------------------------------------------------------------------------------
+// Update only the modules showing columns First_Column up to End_Column of a row of modules, the rest of the frame
+// buffer is not looked at and any changes there are left for the next Display_Update. For a small change, a digit of
+// a clock, that saves comparing the whole frame buffer. The changed registers are sent as Display_Update sends them
+// -----------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Display_Update_Region(int First_Column, int End_Column, uint8_t Band) {
+
+  // No shadow yet, every register has to be sent
+  if (Shadow_Valid == false) {
+    Display_Update();
+    return;
+  }
+
+  if (First_Column < 0) {
+    First_Column = 0;
+  }
+  if (End_Column > Columns) {
+    End_Column = Columns;
+  }
+  if (First_Column >= End_Column || Band >= Rows) {
+    return;
+  }
+
+  MAX7219_Stats_Start(Stats_Timer);
+
+  // Frame buffer offsets of the first module and one past the last, the chips showing them are marked
+  int First_Offset = (Band * Columns) + (First_Column & ~0x07);
+  int End_Offset = (Band * Columns) + ((End_Column + 7) & ~0x07);
+
+  for (int xx = 0; xx < Chips; xx++) {
+    if (Tile_Offset[xx] >= First_Offset && Tile_Offset[xx] < End_Offset) {
+      Mark_Dirty_Chip(xx);
+    }
+  } // end of chip loop
+
+  Display_Flush();
+
+  MAX7219_Stats_Time(Update, Stats_Timer);
+
+} // end of function
+
+
+// ---------------------------------------------------------------------------------------------------
+// Force a full refresh, all data registers are written regardless of the shadow. Use this to recover
+// a display that has been upset (noise, power glitch) and no longer matches the shadow
+// ---------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Display_Refresh() {
+
+  Shadow_Valid = false;
+  Display_Update();
 
 } // end of function
 
@@ -163,9 +1143,9 @@ void Display_Update() {
 // ----------------------
 // Clear the frame buffer
 // ----------------------
-void Clear_Buffer() {
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Clear_Buffer() {
 
-  for (int a = 0; a < (Number_MAX7219 * 8); a++) {
+  for (int a = 0; a < Buffer_Size; a++) {
     Frame_Buffer[a] = 0;
   } // end of loop
 
@@ -175,7 +1155,7 @@ void Clear_Buffer() {
 // ----------------------------------------------
 // Flush the display array and update the display
 // ----------------------------------------------
-void Clear_All() {
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Clear_All() {
 
   // Clear the buffer
   Clear_Buffer();
@@ -186,190 +1166,1987 @@ void Clear_All() {
 } // end Function
 
 
-// ------------------------------------------------------------------------------------------------------------------------------
-// Write a charater to display buffer starting at the location found in column. Column is incrument by the width of the character
-// ------------------------------------------------------------------------------------------------------------------------------
-void Write_Character(int Ascii_Value) {
-
-  for (int Digit_Colummn = 7; Digit_Colummn > -1; Digit_Colummn--) {
+// ----------------------------------------------------------------------------------------------------------------------
+// Lay the chain out over the tiles, row by row from the top left, each row left to right. Serpentine, every other row
+// runs right to left and its modules are turned upside down, so the wiring zig zags down the display. Orientation is how
+// the modules of the top row are turned. Sets every chip, use Layout_Chip after it for any that differ
+// ----------------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Layout_Tiles(bool Serpentine, uint8_t Orientation) {
 
-    int Character_Value = Ascii_Value;
+  int xx = 0;
 
-    // Range check for the ascii value
-    if (Character_Value > 0x1F && Character_Value < 0x7F) {
+  for (int Tile_Y = 0; Tile_Y < Rows; Tile_Y++) {
 
-      // Apply offset as the font table starts at 0 in memory
-      Character_Value = Character_Value - 0x20;
+    bool Reversed = (Serpentine == true && (Tile_Y & 0x01) == 1);
 
-      int Array_Data = Column;
+    for (int Step = 0; Step < Tiles_X; Step++, xx++) {
+      if (Reversed == true) {
+        Layout_Chip(xx, (Tiles_X - 1) - Step, Tile_Y, Orientation ^ 0x02);
+      }
+      else {
+        Layout_Chip(xx, Step, Tile_Y, Orientation);
+      }
+    } // end of tile loop
 
-      // Range check, don't write to array if less than 0 or greater that the array size
-      if (Array_Data > -1 && Array_Data < (Number_MAX7219 * 8)) {
+  } // end of row loop
 
-        // Calculate the MAX7219 chip ID (Number of MAX Chip – INT(Column/8))
-        int MAX_ID = Array_Data / 8;
-        int Row_Bit = Array_Data - (MAX_ID * 8);
+} // end of function
 
-        Array_Data = Array_Data - Row_Bit;
 
-        // Loop 8 times through the character fonts data
-        for (int ii = 0; ii < 8; ii++) {
+// ------------------------------------------------------------------------------------------------------------
+// Set the tile one chip shows and how it is turned, chip 0 is the first from DIN. The whole display is sent on
+// the next update. Chips and tiles off the display are ignored
+// ------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Layout_Chip(int Chip, int Tile_X, int Tile_Y, uint8_t Orientation) {
 
-          // Read font data based on ASII value
-          int Font_Row = pgm_read_byte(&Text_Font[Character_Value] [ii]);
+  if (Chip < 0 || Chip >= Chips || Tile_X < 0 || Tile_X >= Tiles_X || Tile_Y < 0 || Tile_Y >= Rows) {
+    return;
+  }
 
-          // Range check before writing to array
-          if (Array_Data < 0 || Array_Data < (Number_MAX7219 * 8)) {
+  Tile_Offset[Chip] = (uint16_t)(((Tile_Y * Tiles_X) + Tile_X) * 8);
+  Tile_Orientation[Chip] = Orientation & 0x03;
 
-            // Set or clear bit within the display array
-            if (bitRead(Font_Row, Digit_Colummn) == 1) { // Read bit 7
-              bitSet(Frame_Buffer[Array_Data], Row_Bit); // Set bit
-            } // end of bit set
+  Shadow_Valid = false;
 
-            else {
-              bitClear(Frame_Buffer[Array_Data], Row_Bit); // Clear bit
-            } // end of bit clear
+} // end of function
 
-          } // end of loop
 
-          Array_Data++;
+// ----------------------------------------------------------------------------------------------------------
+// Get the 8 data register values of a chip from its tile of the frame buffer, byte i is register 8 - i
+// A Tile_90 chip is its tile as it is, no copy is made. The others are turned into Tile and that is returned
+// ----------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> const uint8_t *MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Map_Tile(int Chip, uint8_t *Tile) {
+
+  const uint8_t *Data = &Frame_Buffer[Tile_Offset[Chip]];
+
+  switch (Tile_Orientation[Chip]) {
+
+    // Upside down, last row first and each row reversed
+    case Tile_270:
+      for (uint8_t i = 0; i < 8; i++) {
+        Tile[i] = MAX7219_Reverse_Bits(Data[7 - i]);
+      } // end of loop
+      return Tile;
+
+    // A quarter turn, register 8 - i is column 7 - i, bit b of it row b
+    case Tile_0:
+      for (uint8_t i = 0; i < 8; i++) {
+        uint8_t Column_Data = 0;
+        for (uint8_t b = 0; b < 8; b++) {
+          Column_Data |= ((Data[b] >> (7 - i)) & 0x01) << b;
+        } // end of row loop
+        Tile[i] = Column_Data;
+      } // end of loop
+      return Tile;
+
+    // The other quarter turn, register 8 - i is column i, bit b of it row 7 - b
+    case Tile_180:
+      for (uint8_t i = 0; i < 8; i++) {
+        uint8_t Column_Data = 0;
+        for (uint8_t b = 0; b < 8; b++) {
+          Column_Data |= ((Data[7 - b] >> i) & 0x01) << b;
+        } // end of row loop
+        Tile[i] = Column_Data;
+      } // end of loop
+      return Tile;
+
+  } // end of switch
+
+  return Data;
 
-        } // end of character loop (ii)
+} // end of function
 
-      } //end of column range check
 
-      // Inc Column position ready for next run
-      // Don't allow the column to increase above the buffers maximum, does this fix bad wrap? Already fixed by column range check
-      //    if (Column < (Number_MAX7219 * 8)) {
-      Column++;
-      //   } // end of column check
+// -----------------------------------------------------------------------------------------------------------------
+// Set or clear one pixel of the frame buffer, X across the whole display and Y down it, 0,0 top left. Shifts and
+// masks only, the tile layout is not looked at. Pixels off the display are ignored, the clip is not used
+// -----------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Pixel_Set(int X, int Y, bool On) {
 
-    } // end of range check
+  if ((unsigned int)X >= (unsigned int)Columns || (unsigned int)Y >= (unsigned int)Height) {
+    return;
+  }
 
-  } // end of loop
+  uint8_t *Data = &Frame_Buffer[((Y >> 3) * Columns) + (X & ~0x07) + (Y & 0x07)];
+  uint8_t Bit = (uint8_t)(1 << (X & 0x07));
+  *Data = (On == true) ? (*Data | Bit) : (*Data & ~Bit);
 
 } // end of function
 
 
-// --------------------------------------------------------
-// Display the text message starting at the location column
-// --------------------------------------------------------
-void Display_Text(String Text_Value, int Location) {
+// -------------------------------------------------------------------------------
+// Draw one pixel, Pixel_Off, Pixel_On or Pixel_Invert. Pixels off the display are ignored
+// -------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Pixel_Draw(int X, int Y, uint8_t Colour) {
 
-  Column = Location;
+  if ((unsigned int)X >= (unsigned int)Columns || (unsigned int)Y >= (unsigned int)Height) {
+    return;
+  }
 
-  Clear_Buffer();       // Clear the frame buffer
+  uint8_t *Data = &Frame_Buffer[((Y >> 3) * Columns) + (X & ~0x07) + (Y & 0x07)];
+  *Data = (uint8_t)MAX7219_Draw_Word(*Data, 1U << (X & 0x07), Colour);
 
-  // Write text message to buffer
-  for (int ll = 0; ll < Text_Value.length(); ll++) {
-    Write_Character(Text_Value.charAt(ll));
-  } // end of loop
+} // end of function
 
-  // Write the frame buffer to the MAX7219 display
-  Display_Update();
+
+// ------------------------------------------------------------------
+// Read one pixel of the frame buffer, pixels off the display are off
+// ------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> bool MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Pixel_Get(int X, int Y) {
+
+  if ((unsigned int)X >= (unsigned int)Columns || (unsigned int)Y >= (unsigned int)Height) {
+    return false;
+  }
+
+  return bitRead(Frame_Buffer[((Y >> 3) * Columns) + (X & ~0x07) + (Y & 0x07)], X & 0x07) == 1;
 
 } // end of function
 
 
-// ------------------------------------------
-// Wipe the text message starting to the left
-// ------------------------------------------
-void Wipe_Text_Left(String Text_Value, int Speed) {
+// ---------------------------------------------------------------------------------------------------------------------
+// Draw a filled rectangle, clipped to the display. Each module it covers takes two word writes, the columns as a byte
+// mask copied into every row lane and the rows as lanes, so a rectangle costs the same however many pixels it has
+// ---------------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Fill_Rect(int X, int Y, int Width, int Height_Pixels, uint8_t Colour) {
 
-  for (int ii = (Number_MAX7219 * 8) + 1; ii > -1; ii--) {
+  // Clip to the display, X1 and Y1 are one past the last column and row
+  int X0 = (X < 0) ? 0 : X;
+  int Y0 = (Y < 0) ? 0 : Y;
+  int X1 = (X + Width > Columns) ? Columns : X + Width;
+  int Y1 = (Y + Height_Pixels > Height) ? Height : Y + Height_Pixels;
+  if (X0 >= X1 || Y0 >= Y1) {
+    return;
+  }
 
-    Column = ii;
+  for (int Tile_Y = Y0 >> 3; Tile_Y <= ((Y1 - 1) >> 3); Tile_Y++) {
 
-    // Write text message to buffer
-    for (int ll = 0; ll < Text_Value.length(); ll++) {
-      Write_Character(Text_Value.charAt(ll));
-    } // end of loop
+    // Row lanes of this row of modules
+    int First_Row = (Tile_Y == (Y0 >> 3)) ? (Y0 & 0x07) : 0;
+    int Last_Row = (Tile_Y == ((Y1 - 1) >> 3)) ? ((Y1 - 1) & 0x07) : 7;
+    uint32_t Top_Lanes = MAX7219_Lane_Mask(First_Row, Last_Row, 0);
+    uint32_t Bottom_Lanes = MAX7219_Lane_Mask(First_Row, Last_Row, 1);
 
-    // Write the frame buffer to the MAX7219 display
-    Display_Update();
+    for (int Tile_X = X0 >> 3; Tile_X <= ((X1 - 1) >> 3); Tile_X++) {
 
-    delay(Speed);
+      uint32_t Column_Mask = MAX7219_Bit_Mask(X0 - (Tile_X * 8), X1 - (Tile_X * 8)) * 0x01010101UL;
+      uint8_t *Data = &Frame_Buffer[(Tile_Y * Columns) + (Tile_X * 8)];
 
-  } // end of loop
+      if (Top_Lanes != 0) {
+        MAX7219_Store_Word(Data, MAX7219_Draw_Word(MAX7219_Load_Word(Data), Column_Mask & Top_Lanes, Colour));
+      }
+      if (Bottom_Lanes != 0) {
+        MAX7219_Store_Word(Data + 4, MAX7219_Draw_Word(MAX7219_Load_Word(Data + 4), Column_Mask & Bottom_Lanes, Colour));
+      }
 
-} // end of function
+    } // end of column loop
 
-// -------------------------------------------
-// Wipe the text message starting to the right
-// -------------------------------------------
-void Wipe_Text_Right(String Text_Value, int Speed) {
+  } // end of row loop
 
-  // Write the text message
-  for (int ii = (0 - (Text_Value.length() * 8)); ii < 1; ii++) {
+} // end of function
 
-    Column = ii;
 
-    // Write text message to buffer
-    for (int ll = 0; ll < Number_MAX7219 * 8; ll++) {
-      Write_Character(Text_Value.charAt(ll));             // Write character at location column
-    } // end of loop
+// ------------------------------------------------------------------------------------------------------------
+// Draw the outline of a rectangle, four filled rectangles that do not overlap so Pixel_Invert works on the corners
+// ------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Draw_Rect(int X, int Y, int Width, int Height_Pixels, uint8_t Colour) {
 
-    // Write the frame buffer to the MAX7219 display
-    Display_Update();
+  if (Width <= 0 || Height_Pixels <= 0) {
+    return;
+  }
 
-    delay(Speed);
+  Fill_Rect(X, Y, Width, 1, Colour);
+  if (Height_Pixels > 1) {
+    Fill_Rect(X, Y + Height_Pixels - 1, Width, 1, Colour);
+  }
+  if (Height_Pixels > 2) {
+    Fill_Rect(X, Y + 1, 1, Height_Pixels - 2, Colour);
+    if (Width > 1) {
+      Fill_Rect(X + Width - 1, Y + 1, 1, Height_Pixels - 2, Colour);
+    }
+  }
 
-  } // end of loop
+} // end of function
 
 
-  // Fill the rest of the buffer with spaces
-  while (Column < (Number_MAX7219 * 8)) {
+// ---------------------------------------------------------------------------------------------------------------
+// Draw a line from X0,Y0 to X1,Y1, both ends drawn. Lines across or down the display are filled rectangles, a word
+// at a time, the others are drawn a pixel at a time (Bresenham)
+// ---------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Draw_Line(int X0, int Y0, int X1, int Y1, uint8_t Colour) {
 
-    Write_Character(0x20);
-    Display_Update();
-    delay(Speed * 30);    // Needs to be slower the the text above
+  if (Y0 == Y1 || X0 == X1) {
+    int Left = (X0 < X1) ? X0 : X1;
+    int Top = (Y0 < Y1) ? Y0 : Y1;
+    Fill_Rect(Left, Top, abs(X1 - X0) + 1, abs(Y1 - Y0) + 1, Colour);
+    return;
+  }
 
+  int Dx = abs(X1 - X0);
+  int Dy = -abs(Y1 - Y0);
+  int Step_X = (X0 < X1) ? 1 : -1;
+  int Step_Y = (Y0 < Y1) ? 1 : -1;
+  int Error = Dx + Dy;
+
+  while (true) {
+    Pixel_Draw(X0, Y0, Colour);
+    if (X0 == X1 && Y0 == Y1) {
+      break;
+    }
+    int Error_2 = 2 * Error;
+    if (Error_2 >= Dy) {
+      Error += Dy;
+      X0 += Step_X;
+    }
+    if (Error_2 <= Dx) {
+      Error += Dx;
+      Y0 += Step_Y;
+    }
   } // end of loop
 
 } // end of function
 
 
-// ------------------------------------
-// Update the xtext at current position
-// ------------------------------------
-void Scroll_Update() {
+// ----------------------------------------------------------------------------------------------------------------------
+// Draw a sprite with its top left at X,Y, clipped to the display. Image is Height rows of (Width + 7) / 8 bytes, bit 0 the
+// left most column, as a frame buffer byte. Mask is the same layout, set where the sprite is drawn and clear where the
+// frame buffer shows through. Mask NULL, the lit pixels of the image are drawn and the rest show through
+// Each sprite byte is shifted into the one or two frame buffer bytes it falls in, 8 pixels at a time
+// ----------------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Draw_Sprite(int X, int Y, const uint8_t *Image, const uint8_t *Mask, int Width, int Height_Pixels) {
 
-  //Serial.print("Scrolling at "); Serial.println(Scroll_Position);
+  int Row_Bytes = (Width + 7) / 8;
+  uint8_t Row_Bit = X & 0x07;
+  int First_Tile = (X - Row_Bit) / 8;             // Module the sprite's first column is in, also right for negative X
 
-  Column = Scroll_Position;
+  for (int Row = 0; Row < Height_Pixels; Row++) {
 
-  // Write text message to buffer
-  for (int ll = 0; ll < Message_Text.length(); ll++) {
-    Write_Character(Message_Text.charAt(ll));
-  } // end of loop
+    int Display_Row = Y + Row;
+    if ((unsigned int)Display_Row >= (unsigned int)Height) {
+      continue;
+    }
 
-  // Write the frame buffer to the MAX7219 display
-  Display_Update();
+    uint8_t *Display_Data = &Frame_Buffer[((Display_Row >> 3) * Columns) + (Display_Row & 0x07)];
 
-  delay(Scroll_Speed);
-  Scroll_Position--;
+    for (int Byte = 0; Byte < Row_Bytes; Byte++) {
 
-  int zz = (0 - (Message_Text.length() * 8));
-  if (Scroll_Position < zz) {
-    Scrolling = false;
-  }
+      // Columns of the last byte past the sprite's width are not drawn
+      uint8_t Width_Mask = MAX7219_Bit_Mask(0, Width - (Byte * 8));
+      uint8_t Data = Image[(Row * Row_Bytes) + Byte];
+      uint8_t Data_Mask = ((Mask != NULL) ? Mask[(Row * Row_Bytes) + Byte] : Data) & Width_Mask;
+      uint16_t Shifted = (uint16_t)Data << Row_Bit;
+      uint16_t Shifted_Mask = (uint16_t)Data_Mask << Row_Bit;
 
-} // end function
+      int Tile = First_Tile + Byte;
+      if (Tile >= 0 && Tile < Tiles_X) {
+        uint8_t *Target_Data = &Display_Data[Tile * 8];
+        *Target_Data = (*Target_Data & ~(uint8_t)Shifted_Mask) | ((uint8_t)Shifted & (uint8_t)Shifted_Mask);
+      }
+      if (Row_Bit != 0 && (Tile + 1) >= 0 && (Tile + 1) < Tiles_X) {
+        uint8_t *Target_Data = &Display_Data[(Tile + 1) * 8];
+        *Target_Data = (*Target_Data & ~(uint8_t)(Shifted_Mask >> 8)) | ((uint8_t)(Shifted >> 8) & (uint8_t)(Shifted_Mask >> 8));
+      }
 
+    } // end of byte loop
 
-// -------------------------
-// Load and start the scroll
-// -------------------------
-void Scroll_Text_Start(String Text, int a) {
+  } // end of row loop
 
-  Scrolling = true;
+} // end of function
 
-  // Position the marker far right
-  Scroll_Position = (Number_MAX7219 * 8) + 1;
-  Message_Text = Text;
-  Scroll_Speed = a;
 
-  Serial.print("Starting scroll at "); Serial.println(Scroll_Position);
+// ------------------------------------------------
+// Invert every pixel of the frame buffer, a word at a time
+// ------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Invert_Buffer() {
+
+  for (int a = 0; a < Buffer_Size; a += 4) {
+    MAX7219_Store_Word(&Frame_Buffer[a], ~MAX7219_Load_Word(&Frame_Buffer[a]));
+  } // end of loop
 
 } // end of function
 
+
+// -------------------------------------------------------------------------------------------------------------------
+// Move the whole frame buffer up Count rows, the top rows are lost and blank rows come in at the bottom. Each column of
+// modules is a run of words from the top, word k takes the rows of words k + Count / 4 and the one after, shifted by
+// whole bytes, so every word is one or two shifts however many rows it moves
+// -------------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Scroll_Buffer_Up(int Count) {
+
+  if (Count <= 0) {
+    return;
+  }
+
+  int Words = Rows * 2;                           // Words in a column of modules
+  int Skip = Count >> 2;                          // Whole words moved
+  uint8_t Shift = (Count & 0x03) * 8;             // Bits the rest moves
+
+  for (int Tile_X = 0; Tile_X < Tiles_X; Tile_X++) {
+
+    uint8_t *Column_Data = &Frame_Buffer[Tile_X * 8];
+
+    for (int k = 0; k < Words; k++) {
+      // Word k of the column is at the module row k / 2, word k & 1 of it
+      uint32_t Word = 0;
+      if ((k + Skip) < Words) {
+        Word = MAX7219_Load_Word(&Column_Data[((k + Skip) >> 1) * Columns + ((k + Skip) & 0x01) * 4]) >> Shift;
+      }
+      if (Shift != 0 && (k + Skip + 1) < Words) {
+        Word |= MAX7219_Load_Word(&Column_Data[((k + Skip + 1) >> 1) * Columns + ((k + Skip + 1) & 0x01) * 4]) << (32 - Shift);
+      }
+      MAX7219_Store_Word(&Column_Data[(k >> 1) * Columns + (k & 0x01) * 4], Word);
+    } // end of word loop
+
+  } // end of column loop
+
+} // end of function
+
+
+// -------------------------------------------------------------------------------------------------------
+// Move the whole frame buffer down Count rows, the bottom rows are lost and blank rows come in at the top
+// -------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Scroll_Buffer_Down(int Count) {
+
+  if (Count <= 0) {
+    return;
+  }
+
+  int Words = Rows * 2;
+  int Skip = Count >> 2;
+  uint8_t Shift = (Count & 0x03) * 8;
+
+  for (int Tile_X = 0; Tile_X < Tiles_X; Tile_X++) {
+
+    uint8_t *Column_Data = &Frame_Buffer[Tile_X * 8];
+
+    for (int k = Words - 1; k >= 0; k--) {
+      uint32_t Word = 0;
+      if ((k - Skip) >= 0) {
+        Word = MAX7219_Load_Word(&Column_Data[((k - Skip) >> 1) * Columns + ((k - Skip) & 0x01) * 4]) << Shift;
+      }
+      if (Shift != 0 && (k - Skip - 1) >= 0) {
+        Word |= MAX7219_Load_Word(&Column_Data[((k - Skip - 1) >> 1) * Columns + ((k - Skip - 1) & 0x01) * 4]) >> (32 - Shift);
+      }
+      MAX7219_Store_Word(&Column_Data[(k >> 1) * Columns + (k & 0x01) * 4], Word);
+    } // end of word loop
+
+  } // end of column loop
+
+} // end of function
+
+
+// ----------------------------------------------------------------------------------------------------------
+// Set the columns of a zone, clipped to the display. Any effect running in the zone is stopped
+// Zones should not overlap, the frame buffer is shared and the last zone drawn wins. Width 0 disables a zone
+// Band is the row of modules the zone is in on a tiled display, text is 8 pixels high so fills one row
+// ----------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Zone_Define(uint8_t Zone_Number, int Start, int Width, uint8_t Band) {
+
+  if (Zone_Number >= MAX7219_Zones || Band >= Rows) {
+    return;
+  }
+
+  Animation_Stop(Zone_Number);
+
+  // Clip to the display
+  if (Start < 0) {
+    Width += Start;
+    Start = 0;
+  }
+  if (Start + Width > Columns) {
+    Width = Columns - Start;
+  }
+  if (Width < 0) {
+    Width = 0;
+  }
+
+  Zones[Zone_Number].Start = Start;
+  Zones[Zone_Number].Width = Width;
+  Zones[Zone_Number].Band = Band;
+
+} // end of function
+
+
+// ---------------------------------------------------------------------------------------
+// Only let writes to the frame buffer change the columns of a zone, in its row of modules
+// ---------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Clip_To_Zone(uint8_t Zone_Number) {
+
+  Clip_Start = Zones[Zone_Number].Start;
+  Clip_End = Zones[Zone_Number].Start + Zones[Zone_Number].Width;
+  Band_Base = Zones[Zone_Number].Band * Columns;
+
+} // end of function
+
+
+// ---------------------------------------------------------------------------
+// Let writes to the frame buffer change every column, text goes to the top row
+// ---------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Clip_Clear() {
+
+  Clip_Start = 0;
+  Clip_End = Columns;
+  Band_Base = 0;
+
+} // end of function
+
+
+// -----------------------------------------------------------------------------------------------
+// Bits of a chip's frame buffer bytes inside the clip, bit 0 is the chips left most column. Chip counts across the row
+// Chips wholly inside the clip get 0xFF, so writes with no zones set cost one compare per chip
+// -----------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> uint8_t MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Clip_Mask(int Chip) {
+
+  return MAX7219_Bit_Mask(Clip_Start - (Chip * 8), Clip_End - (Chip * 8));
+
+} // end of function
+
+
+// ------------------------------------------------
+// Clear the columns of the frame buffer in the clip
+// ------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Clear_Clip() {
+
+  for (int xx = 0; xx < Tiles_X; xx++) {
+    uint8_t Mask = Clip_Mask(xx);
+    if (Mask != 0) {
+      for (uint8_t ii = 0; ii < 8; ii++) {
+        Frame_Buffer[Band_Base + (xx * 8) + ii] &= ~Mask;
+      } // end of row loop
+    }
+  } // end of chip loop
+
+} // end of function
+
+
+// ---------------------------------------------------------------------------------------------------------------
+// Give a zone a column strip buffer, Size bytes holds a message of up to Size columns. Scrolls in the zone then
+// render their message into the strip once and copy a window of it each frame. A message that does not fit is
+// scrolled without the strip. The strip is reused while the zone scrolls the same text, found by its address, so
+// after changing text held in a RAM buffer attach the strip again. Buffer NULL removes the strip
+// ---------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Strip_Attach(uint8_t Zone_Number, uint8_t *Buffer, int Size) {
+
+  if (Zone_Number >= MAX7219_Zones) {
+    return;
+  }
+
+  Animation_Stop(Zone_Number);
+
+  Zones[Zone_Number].Strip = Buffer;
+  Zones[Zone_Number].Strip_Size = (Buffer == NULL) ? 0 : Size;
+  Zones[Zone_Number].Strip_Ready = false;
+
+} // end of function
+
+
+// ---------------------------------------------------------------------------------------------------------------
+// Render a zone's message into its strip, unless the strip already holds it. Leaves Strip_Ready false if the zone
+// has no strip or the message does not fit
+// ---------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Strip_Render(MAX7219_Zone &Zone) {
+
+  int Period = Zone.Message_Width + ((Zone.Marquee == true) ? Zone.Marquee_Gap : 0);
+
+  // Same message, same width, nothing to do
+  if (Zone.Strip_Ready == true && Zone.Strip_Text.Text == Zone.Message_Text.Text && Zone.Strip_Text.Flash == Zone.Message_Text.Flash &&
+      Zone.Strip_Proportional == Proportional && Zone.Strip_Period == Period) {
+    return;
+  }
+
+  Zone.Strip_Ready = false;
+
+  // Whole bytes of the strip used, the columns past the period are left blank
+  int Strip_Bytes = ((Period + 7) / 8) * 8;
+  if (Zone.Strip == NULL || Period <= 0 || Strip_Bytes > Zone.Strip_Size) {
+    return;
+  }
+
+  memset(Zone.Strip, 0, Strip_Bytes);
+
+  for (int Text_Column = 0; Text_Column < Zone.Message_Width; Text_Column++) {
+    uint8_t Column_Data = Message_Column(Zone, Text_Column);
+    if (Column_Data != 0) {
+      uint8_t *Data = &Zone.Strip[(Text_Column / 8) * 8];
+      for (uint8_t ii = 0; ii < 8; ii++) {
+        if (bitRead(Column_Data, ii) == 1) {
+          bitSet(Data[ii], Text_Column & 0x07);
+        }
+      } // end of row loop
+    }
+  } // end of column loop
+
+  Zone.Strip_Text = Zone.Message_Text;
+  Zone.Strip_Proportional = Proportional;
+  Zone.Strip_Period = Period;
+  Zone.Strip_Ready = true;
+
+} // end of function
+
+
+// ---------------------------------------------------------------------------------------------------------------
+// Get one row of 8 columns of the strip, starting at Text_Column of the message. Same layout as a frame buffer byte
+// Columns before the message are blank. Columns after it are blank, or for a marquee the message again
+// ---------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> uint8_t MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Strip_Row(MAX7219_Zone &Zone, int Text_Column, uint8_t Row) {
+
+  int Filled = 0;                                 // Columns of the row done
+  unsigned int Data = 0;
+  int Strip_Columns = ((Zone.Strip_Period + 7) / 8) * 8;
+
+  if (Text_Column < 0) {
+    if (Text_Column <= -8) {
+      return 0;
+    }
+    Filled = 0 - Text_Column;
+    Text_Column = 0;
+  }
+
+  if (Zone.Marquee == true) {
+    Text_Column %= Zone.Strip_Period;
+  }
+
+  while (Filled < 8) {
+
+    // The two strip bytes the 8 columns fall in, nothing past the end of the strip
+    int Byte = (Text_Column / 8) * 8;
+    uint8_t Bit = Text_Column & 0x07;
+    unsigned int Part = 0;
+    if (Byte < Strip_Columns) {
+      Part = Zone.Strip[Byte + Row] >> Bit;
+    }
+    if (Bit != 0 && (Byte + 8) < Strip_Columns) {
+      Part |= (unsigned int)Zone.Strip[Byte + 8 + Row] << (8 - Bit);
+    }
+    Data |= Part << Filled;
+
+    if (Zone.Marquee == false) {
+      break;
+    }
+
+    // Marquee, the columns past the period are blank in the strip, the message starts again after them
+    Filled += Zone.Strip_Period - Text_Column;
+    Text_Column = 0;
+
+  } // end of loop
+
+  return (uint8_t)(Data & 0xFF);
+
+} // end of function
+
+
+// ---------------------------------------------------------------------------------------------------------------
+// Copy the window of the strip showing at the zone's scroll position into the frame buffer, inside the clip only
+// Costs the same for every frame, however long the message, and a skipped frame costs nothing
+// ---------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Strip_Blit(MAX7219_Zone &Zone) {
+
+  int Strip_Columns = ((Zone.Strip_Period + 7) / 8) * 8;
+
+  // Message column at the first chip's left most column, for a marquee kept within one period as it moves along
+  int Text_Column = 0 - Zone.Start - Zone.Scroll_Position;
+  int Wrapped = Text_Column;
+  if (Zone.Marquee == true && Wrapped > 0) {
+    Wrapped %= Zone.Strip_Period;
+  }
+
+  for (int xx = 0; xx < Tiles_X; xx++, Text_Column += 8, Wrapped += 8) {
+
+    if (Zone.Marquee == true) {
+      while (Wrapped >= Zone.Strip_Period) {
+        Wrapped -= Zone.Strip_Period;
+      } // end of loop
+    }
+
+    uint8_t Mask = Clip_Mask(xx);
+    if (Mask == 0) {
+      continue;
+    }
+
+    uint8_t *Data = &Frame_Buffer[Band_Base + (xx * 8)];
+
+    // The 8 columns are all in the message, or off its end when not a marquee, two strip bytes make each row
+    if (Text_Column >= 0 && (Zone.Marquee == false || (Wrapped + 8) <= Zone.Strip_Period)) {
+      int Byte = (Wrapped / 8) * 8;
+      uint8_t Bit = Wrapped & 0x07;
+      const uint8_t *Left = (Byte < Strip_Columns) ? &Zone.Strip[Byte] : NULL;
+      const uint8_t *Right = (Bit != 0 && (Byte + 8) < Strip_Columns) ? &Zone.Strip[Byte + 8] : NULL;
+      for (uint8_t ii = 0; ii < 8; ii++) {
+        uint8_t Row = 0;
+        if (Left != NULL) {
+          Row = Left[ii] >> Bit;
+        }
+        if (Right != NULL) {
+          Row |= (uint8_t)(Right[ii] << (8 - Bit));
+        }
+        Data[ii] = (Data[ii] & ~Mask) | (Row & Mask);
+      } // end of row loop
+    }
+    // Start of the message or a marquee wrapping round within the chip
+    else {
+      for (uint8_t ii = 0; ii < 8; ii++) {
+        Data[ii] = (Data[ii] & ~Mask) | (Strip_Row(Zone, Text_Column, ii) & Mask);
+      } // end of row loop
+    }
+
+  } // end of chip loop
+
+} // end of function
+
+
+// ------------------------------------------------------------------------------------------------------------
+// How many columns a character takes, 8 for fixed width text. Proportional text takes the glyph width plus a
+// one column gap, a blank glyph (space) takes Space_Width. Characters that are not printable take none
+// ------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> uint8_t MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Character_Advance(int Ascii_Value) {
+
+  if (Ascii_Value < 0x20 || Ascii_Value > 0x7E) {
+    return 0;
+  }
+
+  if (Proportional == false) {
+    return 8;
+  }
+
+  uint8_t Width = pgm_read_byte(&Text_Font_Metrics[Ascii_Value - 0x20]) & 0x0F;
+  if (Width == 0) {
+    return Space_Width;
+  }
+  return Width + 1;
+
+} // end of function
+
+
+// ------------------------------------------------
+// Width of a text message in columns as written
+// ------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> int MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Text_Width(const MAX7219_Text &Text_Value) {
+
+  int Width = 0;
+
+  for (unsigned int ll = 0; Text_Value.charAt(ll) != 0; ll++) {
+    Width += Character_Advance(Text_Value.charAt(ll));
+  } // end of loop
+
+  return Width;
+
+} // end of function
+
+
+// -------------------------------------------------------------------------------
+// Load the message used by a zone's effects, measure it and reset the cursor
+// -------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Load_Message(MAX7219_Zone &Zone, const MAX7219_Text &Text_Value) {
+
+  Zone.Message_Text = Text_Value;
+  Zone.Message_Width = Text_Width(Text_Value);
+  Zone.Cursor_Index = 0;
+  Zone.Cursor_Column = 0;
+
+} // end of function
+
+
+// ---------------------------------------------------------------------------------------------------------------
+// Get one column of a zone's message as it would be written by Write_Character, bit 0 is the top row
+// Text_Column is the column from the start of the message, columns outside the message and gaps are blank
+// The cursor follows the columns asked for, so stepping through the message one column at a time costs the same
+// for each column however long the message is
+// ---------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> uint8_t MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Message_Column(MAX7219_Zone &Zone, int Text_Column) {
+
+  if (Text_Column < 0 || Text_Column >= Zone.Message_Width) {
+    return 0;
+  }
+
+  // Going backwards, start again from the first character
+  if (Text_Column < Zone.Cursor_Column) {
+    Zone.Cursor_Index = 0;
+    Zone.Cursor_Column = 0;
+  }
+
+  // Move on to the character holding the column
+  uint8_t Advance = Character_Advance(Zone.Message_Text.charAt(Zone.Cursor_Index));
+  while (Text_Column >= (Zone.Cursor_Column + Advance)) {
+    Zone.Cursor_Column += Advance;
+    Zone.Cursor_Index++;
+    Advance = Character_Advance(Zone.Message_Text.charAt(Zone.Cursor_Index));
+  } // end of loop
+
+  // Pick the column bit out of each of the rotated glyph rows, starting from the first lit column if proportional
+  int Ascii_Value = Zone.Message_Text.charAt(Zone.Cursor_Index);
+  int Font_Index = (Ascii_Value - 0x20) * 8;
+  uint8_t Glyph_Column = Text_Column - Zone.Cursor_Column;
+  if (Proportional == true) {
+    Glyph_Column += pgm_read_byte(&Text_Font_Metrics[Ascii_Value - 0x20]) >> 4;
+  }
+  if (Glyph_Column > 7) {
+    return 0;
+  }
+
+  uint8_t Column_Data = 0;
+
+  for (uint8_t ii = 0; ii < 8; ii++) {
+    Column_Data |= ((pgm_read_byte(&Text_Font_Rotated[Font_Index + ii]) >> Glyph_Column) & 0x01) << ii;
+  } // end of loop
+
+  return Column_Data;
+
+} // end of function
+
+
+// ------------------------------------------------------------------------------------------------------------------------------
+// Write a charater to display buffer starting at the location found in column. Column is incrument by the width of the character
+// Uses the rotated font, each glyph row is one byte. The character's columns are shifted and masked into the one or two chips
+// they fall in, if column is a multiple of 8 and the text is fixed width that is 8 byte writes into one chip
+// Chips off either end of the display are skipped, columns outside the clip (Clip_To_Zone) are left as they are
+// On a tiled display the text goes in the row of modules of the clip, Band_Base
+// ------------------------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Write_Character(int Ascii_Value) {
+
+  MAX7219_Stats_Start(Stats_Timer);
+
+  // Range check for the ascii value, others are ignored and column is not moved
+  if (Ascii_Value > 0x1F && Ascii_Value < 0x7F) {
+
+    // Apply offset as the font table starts at 0 in memory
+    int Font_Index = (Ascii_Value - 0x20) * 8;
+
+    // Columns the character takes, and for proportional text the blank columns to skip at the left of the glyph
+    uint8_t Advance = Character_Advance(Ascii_Value);
+    uint8_t Bearing = 0;
+    if (Proportional == true) {
+      Bearing = pgm_read_byte(&Text_Font_Metrics[Ascii_Value - 0x20]) >> 4;
+    }
+
+    // Bit within the chip the character starts at and the chip it starts in, also right for negative columns
+    uint8_t Row_Bit = Column & 0x07;
+    int MAX_ID = (Column - Row_Bit) / 8;
+
+    // Mask of the columns written, at most 9 wide from bit 7 so it fits 16 bits. Low byte first chip, high byte the next
+    uint16_t Mask = (uint16_t)(((1U << Advance) - 1) << Row_Bit);
+    uint8_t Mask_Left = Mask & 0xFF;
+    uint8_t Mask_Right = Mask >> 8;
+
+    // Clip the character to the chips present and then to the clip
+    bool Left_Present = (Mask_Left != 0 && MAX_ID > -1 && MAX_ID < Tiles_X);
+    bool Right_Present = (Mask_Right != 0 && (MAX_ID + 1) > -1 && (MAX_ID + 1) < Tiles_X);
+    if (Left_Present == true) {
+      Mask_Left &= Clip_Mask(MAX_ID);
+      Left_Present = (Mask_Left != 0);
+    }
+    if (Right_Present == true) {
+      Mask_Right &= Clip_Mask(MAX_ID + 1);
+      Right_Present = (Mask_Right != 0);
+    }
+
+    if (Left_Present == true || Right_Present == true) {
+
+      // Loop 8 times through the character fonts data
+      for (uint8_t ii = 0; ii < 8; ii++) {
+
+        uint16_t Font_Row = (uint16_t)(pgm_read_byte(&Text_Font_Rotated[Font_Index + ii]) >> Bearing) << Row_Bit;
+
+        if (Left_Present == true) {
+          uint8_t *Data = &Frame_Buffer[Band_Base + (MAX_ID * 8) + ii];
+          *Data = (*Data & ~Mask_Left) | ((uint8_t)(Font_Row & 0xFF) & Mask_Left);
+        }
+
+        if (Right_Present == true) {
+          uint8_t *Data = &Frame_Buffer[Band_Base + ((MAX_ID + 1) * 8) + ii];
+          *Data = (*Data & ~Mask_Right) | ((uint8_t)(Font_Row >> 8) & Mask_Right);
+        }
+
+      } // end of character loop (ii)
+
+    } // end of clip check
+
+    // Inc Column position ready for next run
+    Column = Column + Advance;
+
+  } // end of range check
+
+  MAX7219_Stats_Time(Character, Stats_Timer);
+
+} // end of function
+
+
+// ----------------------------------------------------------------------------------------------------------
+// Shift the columns in the clip left by one column, the left most column of the clip is lost, the rest of the
+// frame buffer is not touched. With no clip set that is the whole frame buffer
+// Column_Data is written into the right most column of the clip, bit 0 is the top row. Same layout as Message_Column
+// ----------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Scroll_Buffer_Left(uint8_t Column_Data) {
+
+  if (Clip_End <= Clip_Start) {
+    return;
+  }
+
+  // Chips the clip starts and ends in, and the bit of the right most column
+  int First_Chip = Clip_Start / 8;
+  int Last_Chip = (Clip_End - 1) / 8;
+  uint8_t Last_Bit = (uint8_t)(1 << ((Clip_End - 1) & 0x07));
+
+  for (int xx = First_Chip; xx <= Last_Chip; xx++) {
+
+    uint8_t Mask = Clip_Mask(xx);
+
+    for (uint8_t ii = 0; ii < 8; ii++) {
+
+      // Each chip moves down a bit and takes the left most column of the chip to its right, the last takes the new column
+      uint8_t *Row = &Frame_Buffer[Band_Base + (xx * 8) + ii];
+      uint8_t Data = *Row;
+      uint8_t Shifted = Data >> 1;
+      if (xx < Last_Chip) {
+        Shifted |= (uint8_t)(Row[8] << 7);
+      }
+      else {
+        Shifted = (Shifted & ~Last_Bit) | (bitRead(Column_Data, ii) ? Last_Bit : 0);
+      }
+      *Row = (Data & ~Mask) | (Shifted & Mask);
+
+    } // end of row loop
+
+  } // end of chip loop
+
+} // end of function
+
+
+// --------------------------------------------------------------------------
+// Write a text message to the frame buffer starting at the location in Column
+// --------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Write_Text(const MAX7219_Text &Text_Value) {
+
+  for (unsigned int ll = 0; Text_Value.charAt(ll) != 0; ll++) {
+    Write_Character(Text_Value.charAt(ll));
+  } // end of loop
+
+} // end of function
+
+
+// ---------------------------------------------------------------------------------------
+// Stop any effect running in a zone, the zone is left showing the last frame written to it
+// ---------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Animation_Stop(uint8_t Zone_Number) {
+
+  Zones[Zone_Number].Effect_Type = Effect_None;
+
+} // end of function
+
+
+// --------------------------------------------------------
+// Returns true while an effect is still animating in a zone
+// --------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> bool MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Animation_Running(uint8_t Zone_Number) {
+
+  return (Zones[Zone_Number].Effect_Type != Effect_None);
+
+} // end of function
+
+
+// ----------------------------------------------------
+// Returns true while an effect is animating in any zone
+// ----------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> bool MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Animation_Any_Running() {
+
+  for (uint8_t zz = 0; zz < MAX7219_Zones; zz++) {
+    if (Zones[zz].Effect_Type != Effect_None) {
+      return true;
+    }
+  } // end of loop
+
+  return false;
+
+} // end of function
+
+
+// -----------------------------------------------------------------------------------------------------
+// Start an effect in a zone, the first frame is due straight away. Speed is the frame period in mS
+// A zone with no columns does not start
+// -----------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Animation_Start(uint8_t Zone_Number, uint8_t Type, int Speed) {
+
+  MAX7219_Zone &Zone = Zones[Zone_Number];
+
+  if (Zone.Width == 0) {
+    return;
+  }
+
+  Zone.Effect_Type = Type;
+  Zone.Effect_Speed = Speed;
+  Zone.Frame_Period = (unsigned long)Speed * 1000;
+  Zone.Frame_Due = micros();
+
+#ifdef MAX7219_STATS
+  // The gap before the effect started is not a frame interval
+  Stats.Last_Frame_Valid = false;
+#endif
+
+} // end of function
+
+
+// -----------------------------------------------------------------------------------------------------------
+// Render the next frame of a zone's effect into the frame buffer and advance the effect to the frame after
+// The clip must be set to the zone. The frame is not sent, Animation_Tick sends all the zones' frames together
+// Show = true draws the frame, false skips the frame (late) but keeps the effects state right
+// Returns false if the effect has no frames left
+// -----------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> bool MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Effect_Frame(MAX7219_Zone &Zone, bool Show) {
+
+  switch (Zone.Effect_Type) {
+
+    // Scroll text from the far right until it is off the left of the zone
+    case Effect_Scroll:
+      if (Zone.Strip_Ready == true) {
+        // From the strip, a marquee never ends and its position is kept within one period
+        if (Zone.Marquee == false && Zone.Scroll_Position < (0 - Zone.Message_Width)) {
+          return false;
+        }
+        if (Show == true) {
+          Strip_Blit(Zone);
+        }
+        Zone.Scroll_Position--;
+        if (Zone.Marquee == true && Zone.Scroll_Position <= (0 - Zone.Strip_Period)) {
+          Zone.Scroll_Position += Zone.Strip_Period;
+        }
+        return true;
+      }
+      if (Zone.Scroll_Position < (0 - Zone.Message_Width)) {
+        return false;
+      }
+      if (Scroll_Incremental == true) {
+        // Shift along one column and bring in the message column now at the far right. Must be done for skipped frames
+        // too, Animation_Tick always sends the frame buffer after skipping frames
+        Scroll_Buffer_Left(Message_Column(Zone, (Zone.Width - 1) - Zone.Scroll_Position));
+      }
+      else if (Show == true) {
+        Column = Zone.Start + Zone.Scroll_Position;
+        Write_Text(Zone.Message_Text);
+      }
+      Zone.Scroll_Position--;
+      return true;
+
+    // Wipe text in from the far right until it reaches the zone's first column
+    case Effect_Wipe_Left:
+      if (Zone.Effect_Position < 0) {
+        return false;
+      }
+      if (Show == true) {
+        Column = Zone.Start + Zone.Effect_Position;
+        Write_Text(Zone.Message_Text);
+      }
+      Zone.Effect_Position--;
+      return true;
+
+    // Wipe text in from the left until it reaches the zone's first column, then fill the rest with spaces
+    case Effect_Wipe_Right:
+      // Always write the last frame, the fill carries on from the column it leaves
+      if (Show == true || Zone.Effect_Position == 0) {
+        Column = Zone.Start + Zone.Effect_Position;
+        Write_Text(Zone.Message_Text);
+      }
+      if (Zone.Effect_Position == 0) {
+        Zone.Effect_Position = Column - Zone.Start;
+        Zone.Effect_Type = Effect_Wipe_Fill;
+      }
+      else {
+        Zone.Effect_Position++;
+      }
+      return true;
+
+    // Fill the rest of the zone with spaces, slower than the text above
+    case Effect_Wipe_Fill:
+      if (Zone.Effect_Position >= Zone.Width) {
+        return false;
+      }
+      Zone.Frame_Period = (unsigned long)Zone.Effect_Speed * 30000;
+      Column = Zone.Start + Zone.Effect_Position;
+      Write_Character(0x20);
+      Zone.Effect_Position = Column - Zone.Start;
+      return true;
+
+    // Slide the target in a row at a time, 8 frames. Must be done for skipped frames too, each moves on from the last
+    case Effect_Slide_Up:
+    case Effect_Slide_Down:
+      if (Zone.Effect_Position > 8) {
+        return false;
+      }
+      Slide_Step(Zone, Zone.Effect_Position, Zone.Effect_Type == Effect_Slide_Up);
+      Zone.Effect_Position++;
+      return true;
+
+    // Change to the target 8 pixels of each module a frame, 8 frames. Each frame draws all the steps up to its own
+    case Effect_Dissolve:
+      if (Zone.Effect_Position > 8) {
+        return false;
+      }
+      if (Show == true) {
+        Dissolve_Step(Zone, Zone.Effect_Position);
+      }
+      Zone.Effect_Position++;
+      return true;
+
+    // Roll the counter's changed cells a row a frame, 8 frames. Each frame is drawn from the glyphs alone, so skipped
+    // frames are not drawn, but the last always is
+    case Effect_Roll:
+      if (Zone.Effect_Position > 8) {
+        memcpy(Counter_Old, Counter_Text, sizeof(Counter_Old));
+        return false;
+      }
+      if (Show == true || Zone.Effect_Position == 8) {
+        Counter_Roll_Step(Zone.Effect_Position);
+      }
+      Zone.Effect_Position++;
+      return true;
+
+    // Show the text at the zone's first column, then hold it for one frame period. Always drawn, it is the only frame
+    case Effect_Hold:
+      if (Zone.Effect_Position > 0) {
+        return false;
+      }
+      Clear_Clip();
+      Column = Zone.Start;
+      Write_Text(Zone.Message_Text);
+      Zone.Effect_Position++;
+      return true;
+
+  } // end of switch
+
+  return false;
+
+} // end of function
+
+
+// ----------------------------------------------------------------------------------------------------------------
+// Returns true if the next frame of a zone's effect is its last, or might be, so Animation_Tick never drops it
+// ----------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> bool MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Effect_Last_Frame(MAX7219_Zone &Zone) {
+
+  switch (Zone.Effect_Type) {
+    case Effect_Scroll:
+      return (Zone.Strip_Ready == false || Zone.Marquee == false) && Zone.Scroll_Position <= (0 - Zone.Message_Width);
+    case Effect_Wipe_Left:
+      return (Zone.Effect_Position <= 0);
+    case Effect_Wipe_Right:
+      return (Zone.Effect_Position == 0);         // The fill may have nothing to do
+    case Effect_Wipe_Fill:
+      return (Zone.Effect_Position + Character_Advance(0x20) >= Zone.Width);
+    case Effect_Slide_Up:
+    case Effect_Slide_Down:
+    case Effect_Dissolve:
+    case Effect_Roll:
+      return (Zone.Effect_Position >= 8);
+  } // end of switch
+
+  return true;
+
+} // end of function
+
+
+// ---------------------------------------------------------------------------------------------------------------
+// Run the animation, call this often from loop(). Does at most one frame of work per zone and returns straight away
+// The frames of all the zones that are due are drawn first and then sent with one Display_Update, so zones running
+// at different speeds do not each cost a flush
+// If late by more than a frame period, late frames are either dropped (Drop_Late_Frames) or shown back to back
+// The control and display shadows are re-synced here one register at a time, see Resync_Period
+// Returns the time in uS until the next frame or re-sync step is due, 0 if one is due now or nothing is running
+// ---------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> unsigned long MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Animation_Tick() {
+
+  // Re-sync one register if due, after a long gap carry on from now rather than catching up
+  if (Resync_Period > 0 && (long)(micros() - Resync_Due) >= 0) {
+    Resync_Step();
+    Resync_Due = micros() + Resync_Period;
+  }
+
+  // Nothing running in zone 0, start the next message in the queue if there is one
+  if (Zones[0].Effect_Type == Effect_None && Queue_Count > 0) {
+    Start_Message(Message_Queue[Queue_Head]);
+    Queue_Head = (Queue_Head + 1) % MAX7219_Queue_Size;
+    Queue_Count--;
+  }
+
+  unsigned long Now = micros();
+  bool Frame_Drawn = false;
+  bool Frame_Skipped = false;                     // A skipped frame may have changed the frame buffer (incremental scroll)
+#ifdef MAX7219_STATS
+  unsigned long Tick_Due = 0;                     // Earliest due time of the frames drawn, when this tick was asked for
+#endif
+
+  for (uint8_t zz = 0; zz < MAX7219_Zones; zz++) {
+
+    MAX7219_Zone &Zone = Zones[zz];
+
+    if (Zone.Effect_Type == Effect_None) {
+      continue;
+    }
+
+    unsigned long Late = Now - Zone.Frame_Due;
+
+    // Not due yet, time wrap safe test
+    if ((long)Late < 0) {
+      continue;
+    }
+
+    Clip_To_Zone(zz);
+
+    // Drop any whole frame periods we are late by, keeps the effect running to time. The last frame is never dropped,
+    // it is what the zone is left showing, and a frame is always drawn and sent after the dropped ones. A dropped frame
+    // moves the due time on by the period it was dropped for, a frame that changes the period (the wipe fill) must not
+    // put the next frame's due time after now
+    if (Drop_Late_Frames == true && Zone.Frame_Period > 0) {
+      while (Late >= Zone.Frame_Period && Effect_Last_Frame(Zone) == false) {
+        unsigned long Skipped_Period = Zone.Frame_Period;
+        if (Effect_Frame(Zone, false) == false) {
+          break;
+        }
+        Frame_Skipped = true;
+        Dropped_Frames++;
+        MAX7219_Stats_Count(Dropped_Frames, 1);
+        Zone.Frame_Due += Skipped_Period;
+        Late -= Skipped_Period;
+      } // end of loop
+    }
+
+#ifdef MAX7219_STATS
+    if (Late > (Zone.Frame_Period / 2)) {
+      Stats.Late_Frames++;
+    }
+#endif
+
+    // Draw the frame, the effect ends once the last frame has had its time on the display
+    MAX7219_Stats_Start(Stats_Timer);
+    if (Effect_Frame(Zone, true) == false) {
+      Animation_Stop(zz);
+    }
+    else {
+      MAX7219_Stats_Time(Render, Stats_Timer);
+#ifdef MAX7219_STATS
+      if (Frame_Drawn == false || (long)(Zone.Frame_Due - Tick_Due) < 0) {
+        Tick_Due = Zone.Frame_Due;
+      }
+#endif
+      Zone.Frame_Due += Zone.Frame_Period;
+      Frame_Drawn = true;
+    }
+
+  } // end of zone loop
+
+  Clip_Clear();
+
+  // One flush for every zone drawn, and for skipped frames even if their effect has ended
+  if (Frame_Drawn == true || Frame_Skipped == true) {
+    Display_Update();
+#ifdef MAX7219_STATS
+    // The requested and achieved periods are sampled on the same frames, a frame drawn with one drawn and sent before
+    // it. Requested is the time between the two frames' due times, achieved between them being sent
+    Stats.Frames++;
+    if (Frame_Drawn == true) {
+      unsigned long Frame_Sent = micros();
+      if (Stats.Last_Frame_Valid == true) {
+        Stats.Frame_Interval.Add(Frame_Sent - Stats.Last_Frame);
+        Stats.Requested_Period.Add(Tick_Due - Stats.Last_Due);
+      }
+      Stats.Last_Frame = Frame_Sent;
+      Stats.Last_Due = Tick_Due;
+      Stats.Last_Frame_Valid = true;
+    }
+#endif
+  }
+
+#ifdef MAX7219_STATS
+  // One line report over Serial
+  if (Stats_Report_Period > 0 && (long)(micros() - Stats.Report_Due) >= 0) {
+    Stats_Report();
+    Stats_Reset();
+    Stats.Report_Due = micros() + (Stats_Report_Period * 1000);
+  }
+#endif
+
+  // Time until the next frame due in any zone
+  Now = micros();
+  unsigned long Wait = 0;
+  bool Running = false;
+
+  for (uint8_t zz = 0; zz < MAX7219_Zones; zz++) {
+    if (Zones[zz].Effect_Type != Effect_None) {
+      unsigned long Zone_Wait = Zones[zz].Frame_Due - Now;
+      if ((long)Zone_Wait < 0) {
+        Zone_Wait = 0;
+      }
+      if (Running == false || Zone_Wait < Wait) {
+        Wait = Zone_Wait;
+      }
+      Running = true;
+    }
+  } // end of loop
+
+  if (Resync_Period > 0) {
+    unsigned long Resync_Wait = Resync_Due - Now;
+    if ((long)Resync_Wait < 0) {
+      Resync_Wait = 0;
+    }
+    if (Running == false || Resync_Wait < Wait) {
+      Wait = Resync_Wait;
+    }
+  }
+
+  return Wait;
+
+} // end of function
+
+
+// -------------------------------------------------------------------------------------------
+// Run the animation until a zone's effect has finished, blocking, used by the effects below
+// -------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Animation_Wait(uint8_t Zone_Number) {
+
+  while (Animation_Running(Zone_Number) == true) {
+    Animation_Tick();
+    yield();
+  } // end of loop
+
+} // end of function
+
+
+// ---------------------------------------------------------------------------------
+// Display the text message in a zone, starting at the location column of the zone
+// ---------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Display_Text(MAX7219_Text Text_Value, int Location, uint8_t Zone_Number) {
+
+  // Static text replaces any running effect
+  Animation_Stop(Zone_Number);
+
+  Clip_To_Zone(Zone_Number);
+
+  Column = Zones[Zone_Number].Start + Location;
+
+  Clear_Clip();       // Clear the zone of the frame buffer
+
+  // Write text message to buffer
+  Write_Text(Text_Value);
+
+  Clip_Clear();
+
+  // Write the frame buffer to the MAX7219 display
+  Display_Update();
+
+} // end of function
+
+
+// -----------------------------------------------------------------------------
+// Start wiping the text message in starting to the left, runs from Animation_Tick
+// -----------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Wipe_Text_Left_Start(MAX7219_Text Text_Value, int Speed, uint8_t Zone_Number) {
+
+  Animation_Stop(Zone_Number);
+
+  MAX7219_Zone &Zone = Zones[Zone_Number];
+  Load_Message(Zone, Text_Value);
+  Zone.Effect_Position = Zone.Width + 1;
+  Animation_Start(Zone_Number, Effect_Wipe_Left, Speed);
+
+} // end of function
+
+
+// ------------------------------------------
+// Wipe the text message starting to the left
+// ------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Wipe_Text_Left(MAX7219_Text Text_Value, int Speed, uint8_t Zone_Number) {
+
+  Wipe_Text_Left_Start(Text_Value, Speed, Zone_Number);
+  Animation_Wait(Zone_Number);
+
+} // end of function
+
+
+// ------------------------------------------------------------------------------
+// Start wiping the text message in starting to the right, runs from Animation_Tick
+// ------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Wipe_Text_Right_Start(MAX7219_Text Text_Value, int Speed, uint8_t Zone_Number) {
+
+  Animation_Stop(Zone_Number);
+
+  MAX7219_Zone &Zone = Zones[Zone_Number];
+  Load_Message(Zone, Text_Value);
+  Zone.Effect_Position = 0 - Zone.Message_Width;
+  Animation_Start(Zone_Number, Effect_Wipe_Right, Speed);
+
+} // end of function
+
+
+// -------------------------------------------
+// Wipe the text message starting to the right
+// -------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Wipe_Text_Right(MAX7219_Text Text_Value, int Speed, uint8_t Zone_Number) {
+
+  Wipe_Text_Right_Start(Text_Value, Speed, Zone_Number);
+  Animation_Wait(Zone_Number);
+
+} // end of function
+
+
+// --------------------------------------------------------------------------------------------------------
+// Show the text at the zone's first column and hold it for Time mS, runs from Animation_Tick like the effects
+// --------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Hold_Text_Start(MAX7219_Text Text_Value, int Time, uint8_t Zone_Number) {
+
+  Animation_Stop(Zone_Number);
+
+  MAX7219_Zone &Zone = Zones[Zone_Number];
+  Load_Message(Zone, Text_Value);
+  Zone.Effect_Position = 0;
+  Animation_Start(Zone_Number, Effect_Hold, Time);
+
+} // end of function
+
+
+// ----------------------------------------------------------------------------------------------------------------------
+// Start a transition in a zone from what it shows to Target, runs from Animation_Tick like the effects, 8 frames of Speed
+// mS. Type is Effect_Slide_Up, Effect_Slide_Down or Effect_Dissolve. Target is a picture in the frame buffer layout,
+// Buffer_Size bytes, only the zone's columns of its row of modules are used. It is not copied and must stay put until
+// the transition has finished, draw it with a second display's frame buffer or a buffer of your own
+// ----------------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Transition_Start(const uint8_t *Target, uint8_t Type, int Speed, uint8_t Zone_Number) {
+
+  Animation_Stop(Zone_Number);
+
+  MAX7219_Zone &Zone = Zones[Zone_Number];
+  Zone.Target = Target;
+  Zone.Effect_Position = 1;
+  Animation_Start(Zone_Number, Type, Speed);
+
+} // end of function
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// One frame of a slide, Step 1 to 8. The zone's modules move a row up (or down) and the target's row Step - 1 (or
+// 8 - Step) comes in at the bottom (top). Each module is two words, shifted a byte and masked to the clip
+// ---------------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Slide_Step(MAX7219_Zone &Zone, uint8_t Step, bool Up) {
+
+  for (int xx = 0; xx < Tiles_X; xx++) {
+
+    uint8_t Mask = Clip_Mask(xx);
+    if (Mask == 0) {
+      continue;
+    }
+
+    uint32_t Mask_Word = Mask * 0x01010101UL;
+    uint8_t *Data = &Frame_Buffer[Band_Base + (xx * 8)];
+    uint32_t Top = MAX7219_Load_Word(Data);
+    uint32_t Bottom = MAX7219_Load_Word(Data + 4);
+    uint32_t New_Top;
+    uint32_t New_Bottom;
+
+    if (Up == true) {
+      New_Top = (Top >> 8) | (Bottom << 24);
+      New_Bottom = (Bottom >> 8) | ((uint32_t)Zone.Target[Band_Base + (xx * 8) + (Step - 1)] << 24);
+    }
+    else {
+      New_Bottom = (Bottom << 8) | (Top >> 24);
+      New_Top = (Top << 8) | Zone.Target[Band_Base + (xx * 8) + (8 - Step)];
+    }
+
+    MAX7219_Store_Word(Data, (Top & ~Mask_Word) | (New_Top & Mask_Word));
+    MAX7219_Store_Word(Data + 4, (Bottom & ~Mask_Word) | (New_Bottom & Mask_Word));
+
+  } // end of chip loop
+
+} // end of function
+
+
+// ---------------------------------------------------------------------------------------------------------------
+// One frame of a dissolve, Step 1 to 8. The pixels due by this step (MAX7219_Dissolve_Order) take the target's
+// value. The masks are the same for every module, built once a frame, then each module is two masked word copies
+// ---------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Dissolve_Step(MAX7219_Zone &Zone, uint8_t Step) {
+
+  uint8_t Row_Masks[8] = {};
+  for (uint8_t i = 0; i < 64; i++) {
+    if (pgm_read_byte(&MAX7219_Dissolve_Order[i]) < (Step * 8)) {
+      Row_Masks[i >> 3] |= (uint8_t)(1 << (i & 0x07));
+    }
+  } // end of loop
+  uint32_t Top_Mask = MAX7219_Load_Word(Row_Masks);
+  uint32_t Bottom_Mask = MAX7219_Load_Word(Row_Masks + 4);
+
+  for (int xx = 0; xx < Tiles_X; xx++) {
+
+    uint8_t Mask = Clip_Mask(xx);
+    if (Mask == 0) {
+      continue;
+    }
+
+    uint32_t Mask_Word = Mask * 0x01010101UL;
+    uint8_t *Data = &Frame_Buffer[Band_Base + (xx * 8)];
+    const uint8_t *Target = &Zone.Target[Band_Base + (xx * 8)];
+    uint32_t Top = Top_Mask & Mask_Word;
+    uint32_t Bottom = Bottom_Mask & Mask_Word;
+
+    MAX7219_Store_Word(Data, (MAX7219_Load_Word(Data) & ~Top) | (MAX7219_Load_Word(Target) & Top));
+    MAX7219_Store_Word(Data + 4, (MAX7219_Load_Word(Data + 4) & ~Bottom) | (MAX7219_Load_Word(Target + 4) & Bottom));
+
+  } // end of chip loop
+
+} // end of function
+
+
+// ----------------------------------------------------------------------------------
+// Update the text at current position, non blocking, the scroll runs from the ticker
+// ----------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Scroll_Update() {
+
+  Animation_Tick();
+
+} // end function
+
+
+// -------------------------
+// Load and start the scroll
+// -------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Scroll_Text_Start(MAX7219_Text Text, int a, uint8_t Zone_Number) {
+
+  Animation_Stop(Zone_Number);
+
+  MAX7219_Zone &Zone = Zones[Zone_Number];
+
+  // Position the marker far right
+  Zone.Scroll_Position = Zone.Width + 1;
+  Load_Message(Zone, Text);
+
+  // Render into the strip if the zone has one, only if the text has changed
+  Strip_Render(Zone);
+
+  Animation_Start(Zone_Number, Effect_Scroll, a);
+
+} // end of function
+
+
+#ifdef MAX7219_STATS
+// ------------------------------------------------------------------------------
+// Start the statistics again, the report timer and last frame times are kept
+// ------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Stats_Reset() {
+
+  unsigned long Last_Frame = Stats.Last_Frame;
+  unsigned long Last_Due = Stats.Last_Due;
+  bool Last_Frame_Valid = Stats.Last_Frame_Valid;
+  unsigned long Report_Due = Stats.Report_Due;
+
+  Stats = MAX7219_Stats();
+  Stats.Last_Frame = Last_Frame;
+  Stats.Last_Due = Last_Due;
+  Stats.Last_Frame_Valid = Last_Frame_Valid;
+  Stats.Report_Due = Report_Due;
+
+} // end of function
+
+
+// -------------------------------------------------------------------------------------------------------------------
+// Print the statistics over Serial on one line, times in uS as min/avg/max, for example
+// Frames 100 Period 10000/10012 Late 0 Dropped 0 Bytes 1200 Trans 150 Char 4/6/12 Send 20/24/40 Update 60/80/140 Render 40/52/96
+// Frames and Period are animation frames sent and the average requested/achieved frame period
+// -------------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Stats_Report() {
+
+  const MAX7219_Stage *Stages[4] = { &Stats.Character, &Stats.Send, &Stats.Update, &Stats.Render };
+  const char *Names[4] = { " Char ", " Send ", " Update ", " Render " };
+
+  Serial.print("Frames "); Serial.print(Stats.Frames);
+  Serial.print(" Period "); Serial.print(Stats.Requested_Period.Average());
+  Serial.print("/"); Serial.print(Stats.Frame_Interval.Average());
+  Serial.print(" Late "); Serial.print(Stats.Late_Frames);
+  Serial.print(" Dropped "); Serial.print(Stats.Dropped_Frames);
+  Serial.print(" Bytes "); Serial.print(Stats.Bytes);
+  Serial.print(" Trans "); Serial.print(Stats.Transactions);
+
+  for (uint8_t i = 0; i < 4; i++) {
+    Serial.print(Names[i]); Serial.print(Stages[i]->Min);
+    Serial.print("/"); Serial.print(Stages[i]->Average());
+    Serial.print("/"); Serial.print(Stages[i]->Max);
+  } // end of loop
+
+  Serial.println();
+
+} // end of function
+#endif
+
+
+// -------------------------------------------------------------------------------------------------------------------
+// Add a message to the queue, it is shown once the messages before it have finished. Returns false if the queue is full
+// Effect is Effect_Scroll, Effect_Wipe_Left, Effect_Wipe_Right or Effect_Hold, the text is not copied
+// -------------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> bool MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Queue_Message(MAX7219_Text Text_Value, uint8_t Effect, int Speed) {
+
+  if (Queue_Count >= MAX7219_Queue_Size) {
+    return false;
+  }
+
+  MAX7219_Message &Message = Message_Queue[(Queue_Head + Queue_Count) % MAX7219_Queue_Size];
+  Message.Text = Text_Value;
+  Message.Effect = Effect;
+  Message.Speed = Speed;
+  Queue_Count++;
+
+  return true;
+
+} // end of function
+
+
+// ---------------------------------------------------------------
+// Number of messages waiting, not counting the one being shown
+// ---------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> uint8_t MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Queue_Pending() {
+
+  return Queue_Count;
+
+} // end of function
+
+
+// -----------------------------------------------------------------------
+// Drop all waiting messages, the one being shown carries on to the end
+// -----------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Queue_Clear() {
+
+  Queue_Head = 0;
+  Queue_Count = 0;
+
+} // end of function
+
+
+// --------------------------------------------------
+// Start showing a message with its effect and speed
+// --------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Start_Message(const MAX7219_Message &Message) {
+
+  switch (Message.Effect) {
+    case Effect_Scroll: Scroll_Text_Start(Message.Text, Message.Speed); break;
+    case Effect_Wipe_Left: Wipe_Text_Left_Start(Message.Text, Message.Speed); break;
+    case Effect_Wipe_Right: Wipe_Text_Right_Start(Message.Text, Message.Speed); break;
+    default: Hold_Text_Start(Message.Text, Message.Speed); break;
+  } // end of switch
+
+} // end of function
+
+
+
+// ----------------------------------------------------------------------------------------------------------------------
+// Start a clock or counter in a zone, its first cell at Location columns into the zone. Counter_Show then draws the text
+// a cell a character and later redraws only the cells whose character has changed. Roll_Speed 0 a changed cell is drawn
+// at once, otherwise in mS per frame the old character rolls up out of the cell and the new one in from below, 8 frames
+// run from Animation_Tick. The digits are rendered here, call it again after changing Proportional or drawing over the
+// zone with anything else
+// ----------------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Counter_Start(uint8_t Zone_Number, int Location, int Roll_Speed) {
+
+  Animation_Stop(Zone_Number);
+
+  Counter_Zone = Zone_Number;
+  Counter_Location = Location;
+  Counter_Roll_Speed = Roll_Speed;
+  Counter_Length = 0;
+
+  // Every digit cell is as wide as the widest digit
+  Counter_Digit_Width = 0;
+  for (uint8_t Digit = 0; Digit < 10; Digit++) {
+
+    int Font_Index = ('0' + Digit - 0x20) * 8;
+    uint8_t Bearing = 0;
+    if (Proportional == true) {
+      Bearing = pgm_read_byte(&Text_Font_Metrics['0' + Digit - 0x20]) >> 4;
+    }
+    for (uint8_t ii = 0; ii < 8; ii++) {
+      Counter_Glyphs[Digit][ii] = pgm_read_byte(&Text_Font_Rotated[Font_Index + ii]) >> Bearing;
+    } // end of row loop
+
+    if (Character_Advance('0' + Digit) > Counter_Digit_Width) {
+      Counter_Digit_Width = Character_Advance('0' + Digit);
+    }
+
+  } // end of digit loop
+
+} // end of function
+
+
+// -----------------------------------------------------------------------------------------------------------------------
+// Show text in the counter, up to MAX7219_Counter_Cells characters. The first time, or if a cell's character has changed
+// to one of a different width (a digit to a colon, say), the whole zone is drawn again. Otherwise only the cells whose
+// character has changed are drawn, or start rolling, and only the modules they are on are compared and sent. A roll still
+// going when the text changes again is cut short, its cells go straight to their characters before the next roll starts
+// -----------------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Counter_Show(MAX7219_Text Text_Value) {
+
+  MAX7219_Zone &Zone = Zones[Counter_Zone];
+
+  char New_Text[MAX7219_Counter_Cells];
+  uint8_t Length = 0;
+  while (Length < MAX7219_Counter_Cells && Text_Value.charAt(Length) != 0) {
+    New_Text[Length] = Text_Value.charAt(Length);
+    Length++;
+  } // end of loop
+
+  // Same cells as drawn, the layout stays and only changed cells are drawn
+  bool Same_Layout = (Length == Counter_Length);
+  for (uint8_t Cell = 0; Cell < Length && Same_Layout == true; Cell++) {
+    Same_Layout = (Counter_Cell_Width(New_Text[Cell]) == Counter_Cell_Width(Counter_Text[Cell]));
+  } // end of loop
+
+  bool Rolling = (Zone.Effect_Type == Effect_Roll);
+  Animation_Stop(Counter_Zone);
+
+  Clip_To_Zone(Counter_Zone);
+
+  uint8_t Rows_Data[8];
+  int First_Column = Columns;                     // Columns drawn, sent once all the cells are drawn
+  int End_Column = 0;
+  bool Roll = false;
+
+  if (Same_Layout == false) {
+
+    // Lay the cells out again from the start of the zone and draw them all
+    Clear_Clip();
+    int Cell_Column = Zone.Start + Counter_Location;
+    for (uint8_t Cell = 0; Cell < Length; Cell++) {
+      Counter_Column[Cell] = Cell_Column;
+      Counter_Text[Cell] = New_Text[Cell];
+      Counter_Old[Cell] = New_Text[Cell];
+      Counter_Draw_Cell(Cell, Counter_Glyph(New_Text[Cell], Rows_Data));
+      Cell_Column += Counter_Cell_Width(New_Text[Cell]);
+    } // end of cell loop
+    Counter_Length = Length;
+    First_Column = Zone.Start;
+    End_Column = Zone.Start + Zone.Width;
+
+  }
+  else {
+
+    for (uint8_t Cell = 0; Cell < Length; Cell++) {
+
+      bool Changed = (New_Text[Cell] != Counter_Text[Cell]);
+      bool Part_Rolled = (Rolling == true && Counter_Old[Cell] != Counter_Text[Cell]);
+
+      if (Changed == true && Counter_Roll_Speed > 0) {
+        // Drawn by the roll, from the character it was showing or was rolling to
+        Counter_Old[Cell] = Counter_Text[Cell];
+        Roll = true;
+      }
+      else if (Changed == true || Part_Rolled == true) {
+        Counter_Old[Cell] = New_Text[Cell];
+        Counter_Draw_Cell(Cell, Counter_Glyph(New_Text[Cell], Rows_Data));
+        if (Counter_Column[Cell] < First_Column) {
+          First_Column = Counter_Column[Cell];
+        }
+        if (Counter_Column[Cell] + Counter_Cell_Width(New_Text[Cell]) > End_Column) {
+          End_Column = Counter_Column[Cell] + Counter_Cell_Width(New_Text[Cell]);
+        }
+      }
+
+      Counter_Text[Cell] = New_Text[Cell];
+
+    } // end of cell loop
+
+  }
+
+  Clip_Clear();
+
+  Display_Update_Region(First_Column, End_Column, Zone.Band);
+
+  // The first frame of the roll is drawn on the next Animation_Tick
+  if (Roll == true) {
+    Zone.Effect_Position = 1;
+    Animation_Start(Counter_Zone, Effect_Roll, Counter_Roll_Speed);
+  }
+
+} // end of function
+
+
+// ----------------------------------------------------------------------------------------------------------
+// Columns a counter cell takes for a character, digits all take the width of the widest so they line up
+// ----------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> uint8_t MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Counter_Cell_Width(char Character) {
+
+  if (Character >= '0' && Character <= '9') {
+    return Counter_Digit_Width;
+  }
+
+  return Character_Advance(Character);
+
+} // end of function
+
+
+// ----------------------------------------------------------------------------------------------------------------
+// The rows of a character as drawn in a counter cell, bit 0 the left most column. Digits are the glyphs rendered by
+// Counter_Start, other characters are read from the font into Rows_Data
+// ----------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> const uint8_t *MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Counter_Glyph(char Character, uint8_t *Rows_Data) {
+
+  if (Character >= '0' && Character <= '9') {
+    return Counter_Glyphs[Character - '0'];
+  }
+
+  memset(Rows_Data, 0, 8);
+  if (Character > 0x1F && Character < 0x7F) {
+    int Font_Index = (Character - 0x20) * 8;
+    uint8_t Bearing = 0;
+    if (Proportional == true) {
+      Bearing = pgm_read_byte(&Text_Font_Metrics[Character - 0x20]) >> 4;
+    }
+    for (uint8_t ii = 0; ii < 8; ii++) {
+      Rows_Data[ii] = pgm_read_byte(&Text_Font_Rotated[Font_Index + ii]) >> Bearing;
+    } // end of row loop
+  }
+
+  return Rows_Data;
+
+} // end of function
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Draw 8 rows into a counter cell, shifted and masked into the one or two modules the cell is on as Write_Character does
+// Columns outside the clip are left as they are, the caller sets the clip to the counter's zone
+// ---------------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Counter_Draw_Cell(uint8_t Cell, const uint8_t *Rows_Data) {
+
+  int Cell_Column = Counter_Column[Cell];
+  uint8_t Width = Counter_Cell_Width(Counter_Text[Cell]);
+
+  uint8_t Row_Bit = Cell_Column & 0x07;
+  int MAX_ID = (Cell_Column - Row_Bit) / 8;
+
+  uint16_t Mask = (uint16_t)(((1U << Width) - 1) << Row_Bit);
+  uint8_t Mask_Left = (MAX_ID > -1 && MAX_ID < Tiles_X) ? (uint8_t)(Mask & 0xFF) & Clip_Mask(MAX_ID) : 0;
+  uint8_t Mask_Right = ((MAX_ID + 1) > -1 && (MAX_ID + 1) < Tiles_X) ? (uint8_t)(Mask >> 8) & Clip_Mask(MAX_ID + 1) : 0;
+
+  for (uint8_t ii = 0; ii < 8; ii++) {
+
+    uint16_t Row = (uint16_t)Rows_Data[ii] << Row_Bit;
+
+    if (Mask_Left != 0) {
+      uint8_t *Data = &Frame_Buffer[Band_Base + (MAX_ID * 8) + ii];
+      *Data = (*Data & ~Mask_Left) | ((uint8_t)(Row & 0xFF) & Mask_Left);
+    }
+
+    if (Mask_Right != 0) {
+      uint8_t *Data = &Frame_Buffer[Band_Base + ((MAX_ID + 1) * 8) + ii];
+      *Data = (*Data & ~Mask_Right) | ((uint8_t)(Row >> 8) & Mask_Right);
+    }
+
+  } // end of row loop
+
+} // end of function
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// One frame of the counter's roll, Step 1 to 8. Each rolling cell shows the old character moved up Step rows with the
+// top of the new one under it, at Step 8 just the new one
+// --------------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Counter_Roll_Step(uint8_t Step) {
+
+  uint8_t Old_Data[8];
+  uint8_t New_Data[8];
+  uint8_t Rows_Data[8];
+
+  for (uint8_t Cell = 0; Cell < Counter_Length; Cell++) {
+
+    if (Counter_Old[Cell] == Counter_Text[Cell]) {
+      continue;
+    }
+
+    const uint8_t *Old_Rows = Counter_Glyph(Counter_Old[Cell], Old_Data);
+    const uint8_t *New_Rows = Counter_Glyph(Counter_Text[Cell], New_Data);
+    for (uint8_t ii = 0; ii < 8; ii++) {
+      Rows_Data[ii] = ((ii + Step) < 8) ? Old_Rows[ii + Step] : New_Rows[ii + Step - 8];
+    } // end of row loop
+
+    Counter_Draw_Cell(Cell, Rows_Data);
+
+  } // end of cell loop
+
+} // end of function
+
+
+// ------------------------------------------------------------------------------------------------------------------------
+// Show frames streamed from a PC on Port, see Stream_Sync for the frames. Effects and queued messages are stopped, they
+// would send the frame buffer while a frame is part way in. The first frame must be a full frame, Stream_Ack is sent
+// now to say the display is ready for it. Call Stream_Poll from loop()
+// ------------------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Stream_Start(Stream &Port) {
+
+  for (uint8_t zz = 0; zz < MAX7219_Zones; zz++) {
+    Animation_Stop(zz);
+  } // end of loop
+  Queue_Clear();
+  Clip_Clear();
+
+  Stream_Port = &Port;
+  Stream_State = Stream_Wait_Sync;
+  Stream_Need_Full = true;
+  Stream_Ack_Pending = false;
+
+  Stream_Port->write(Stream_Ack);
+
+} // end of function
+
+
+// ------------------------------------------------------------------------------------------
+// Stop streaming, the display keeps the last frame shown. Any frame part way in is dropped
+// ------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Stream_Stop() {
+
+  Stream_Port = NULL;
+  Stream_State = Stream_Wait_Sync;
+
+} // end of function
+
+
+// ------------------------------------------------------------------------------------------------------------------------
+// Read the bytes waiting on the stream port into the frame buffer, non blocking. Stops once a frame has been shown and
+// leaves anything after it in the port until the frame's ACK has gone, so a PC sending faster than Stream_Frame_Period
+// is held back. Returns true if a frame was shown
+// ------------------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> bool MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Stream_Poll() {
+
+  if (Stream_Port == NULL || Stream_Ready() == false) {
+    return false;
+  }
+
+  // A frame stopped part way, drop it and ask for a full frame
+  if (Stream_State != Stream_Wait_Sync && Stream_Port->available() == 0 && (micros() - Stream_Last_Byte) >= Stream_Timeout) {
+    Stream_State = Stream_Wait_Sync;
+    Stream_End_Frame(false);
+  }
+
+  bool Shown = false;
+  bool Received = false;
+
+  while (Shown == false && Stream_Port->available() > 0) {
+    Shown = Stream_Byte((uint8_t)Stream_Port->read());
+    Received = true;
+  } // end of loop
+
+  if (Received == true) {
+    Stream_Last_Byte = micros();
+  }
+
+  // No frame period, the ACK goes straight away
+  Stream_Ready();
+
+  return Shown;
+
+} // end of function
+
+
+// -----------------------------------------------------------------------------------------------------------------
+// Take one byte of the stream, payload bytes go straight into the frame buffer. Returns true if it finished a frame
+// that was shown
+// -----------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> bool MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Stream_Byte(uint8_t Data) {
+
+  switch (Stream_State) {
+
+    case Stream_Wait_Sync:
+      if (Data == Stream_Sync) {
+        Stream_State = Stream_Wait_Type;
+      }
+      break;
+
+    case Stream_Wait_Type:
+      Stream_Type = Data;
+      Stream_Sum = Data;
+      Stream_Bad = false;
+      if (Data == Stream_Full_Frame) {
+        Stream_Offset = 0;
+        Stream_Remaining = Buffer_Size;
+        Stream_State = Stream_Data;
+      }
+      else if (Data == Stream_Delta_Frame) {
+        Stream_Header = 0;
+        Stream_Bad = Stream_Need_Full;
+        Stream_State = Stream_Run_Header;
+      }
+      // Not a frame, look for the next sync
+      else {
+        Stream_State = Stream_Wait_Sync;
+      }
+      break;
+
+    case Stream_Run_Header:
+      Stream_Sum += Data;
+      if (Stream_Header == 0) {
+        Stream_Offset = Data;
+        Stream_Header = 1;
+      }
+      else if (Stream_Header == 1) {
+        Stream_Offset |= (unsigned int)Data << 8;
+        Stream_Header = 2;
+      }
+      else {
+        Stream_Remaining = Data;
+        Stream_Header = 0;
+        if (((unsigned long)Stream_Offset + Data) > Buffer_Size) {
+          Stream_Bad = true;
+        }
+        Stream_State = (Data == 0) ? Stream_Checksum : Stream_Data;
+      }
+      break;
+
+    case Stream_Data:
+      Stream_Sum += Data;
+      if (Stream_Bad == false) {
+        Frame_Buffer[Stream_Offset] = Data;
+      }
+      Stream_Offset++;
+      if (--Stream_Remaining == 0) {
+        Stream_State = (Stream_Type == Stream_Full_Frame) ? Stream_Checksum : Stream_Run_Header;
+      }
+      break;
+
+    case Stream_Checksum:
+      Stream_State = Stream_Wait_Sync;
+      Stream_End_Frame(Stream_Bad == false && Data == Stream_Sum);
+      return (Stream_Ack_Pending == true);
+
+  } // end of switch
+
+  return false;
+
+} // end of function
+
+
+// ---------------------------------------------------------------------------------------------------------------
+// A frame has ended. A good one is sent to the chips and its ACK held until the frame period is up. A bad one may
+// have left the frame buffer part written, deltas are refused until a full frame comes in
+// ---------------------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> void MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Stream_End_Frame(bool Good) {
+
+  if (Good == true) {
+    Display_Update();
+    Stream_Need_Full = false;
+    Stream_Frames++;
+    Stream_Ack_Pending = true;
+    Stream_Ack_Due = micros() + Stream_Frame_Period;
+  }
+  else {
+    Stream_Need_Full = true;
+    Stream_Errors++;
+    Stream_Port->write(Stream_Nak);
+  }
+
+} // end of function
+
+
+// -------------------------------------------------------------------------------------------------
+// Send the held ACK once it is due. Returns true if no ACK is held, the next frame can be read
+// -------------------------------------------------------------------------------------------------
+template <int Chips, uint8_t Cs_Pin, int Chains, int Rows> bool MAX7219_Matrix<Chips, Cs_Pin, Chains, Rows>::Stream_Ready() {
+
+  if (Stream_Ack_Pending == true) {
+    if ((long)(micros() - Stream_Ack_Due) < 0) {
+      return false;
+    }
+    Stream_Port->write(Stream_Ack);
+    Stream_Ack_Pending = false;
+  }
+
+  return true;
+
+} // end of function
@@ -0,0 +1,177 @@
+/*
+  Host (Linux) stand in for the Arduino core, just enough to build the display functions with g++
+  Time is virtual, micros() only moves when the host program moves it, so effects can be stepped frame by frame
+*/
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <unistd.h>
+#include <sys/ioctl.h>
+
+typedef uint8_t byte;
+
+#define PROGMEM
+#define pgm_read_byte(Address) (Host_Read_Flash(Address))
+
+// Flash strings, on the host they are ordinary strings marked with a different type as on the AVR
+class __FlashStringHelper;
+#define PSTR(Text) (Text)
+#define F(Text) (reinterpret_cast<const __FlashStringHelper *>(PSTR(Text)))
+#define strlen_P strlen
+
+#define bitRead(Value, Bit) (((Value) >> (Bit)) & 0x01)
+#define bitSet(Value, Bit) ((Value) |= (1UL << (Bit)))
+#define bitClear(Value, Bit) ((Value) &= ~(1UL << (Bit)))
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+#define MSBFIRST 1
+
+
+// ---------------------------------------------------------------------------------
+// Virtual clock, in uS. Host_Advance moves it on, delay() and yield() move it too
+// ---------------------------------------------------------------------------------
+inline unsigned long &Host_Clock() {
+  static unsigned long Now = 0;
+  return Now;
+}
+
+inline void Host_Advance(unsigned long Time_Us) {
+  Host_Clock() += Time_Us;
+}
+
+inline unsigned long micros() {
+  return Host_Clock();
+}
+
+inline unsigned long millis() {
+  return Host_Clock() / 1000;
+}
+
+inline void delay(unsigned long Time_Ms) {
+  Host_Advance(Time_Ms * 1000);
+}
+
+inline void delayMicroseconds(unsigned int Time_Us) {
+  Host_Advance(Time_Us);
+}
+
+inline void yield() {
+  Host_Advance(1);
+}
+
+// Flash reads, mostly the font as text is drawn. Each moves the clock on Host_Flash_Read_Us, 0 by default, so the
+// statistics see the time taken to draw
+inline unsigned long &Host_Flash_Read_Us() {
+  static unsigned long Time_Us = 0;
+  return Time_Us;
+}
+
+inline uint8_t Host_Read_Flash(const void *Address) {
+  Host_Advance(Host_Flash_Read_Us());
+  return *(const uint8_t *)Address;
+}
+
+
+// --------------------------------------------------------------------------------------------
+// Pins, only the last written level is remembered. 8 pins to a port, with a 32 bit port register
+// --------------------------------------------------------------------------------------------
+inline volatile uint32_t *Host_Port(uint8_t Port) {
+  static volatile uint32_t Ports[32];
+  return &Ports[Port];
+}
+
+#define digitalPinToPort(Pin) ((uint8_t)((Pin) / 8))
+#define digitalPinToBitMask(Pin) ((uint32_t)(1 << ((Pin) % 8)))
+#define portOutputRegister(Port) (Host_Port(Port))
+
+inline void pinMode(uint8_t Pin, uint8_t Mode) {
+  (void)Pin;
+  (void)Mode;
+}
+
+inline void digitalWrite(uint8_t Pin, uint8_t Level) {
+  if (Level == LOW) {
+    *portOutputRegister(digitalPinToPort(Pin)) &= ~digitalPinToBitMask(Pin);
+  }
+  else {
+    *portOutputRegister(digitalPinToPort(Pin)) |= digitalPinToBitMask(Pin);
+  }
+}
+
+inline int digitalRead(uint8_t Pin) {
+  return (*portOutputRegister(digitalPinToPort(Pin)) & digitalPinToBitMask(Pin)) ? HIGH : LOW;
+}
+
+
+// ------------------------------------------------------
+// Cut down String, what the display functions make use of
+// ------------------------------------------------------
+class String {
+  public:
+    String(const char *Text = "") : Value(Text) {}
+    unsigned int length() const { return Value.size(); }
+    char charAt(unsigned int Index) const { return Index < Value.size() ? Value[Index] : 0; }
+    const char *c_str() const { return Value.c_str(); }
+  private:
+    std::string Value;
+};
+
+
+// ------------------------------------------------------------
+// Byte stream, the part of the Arduino Stream class the display uses
+// ------------------------------------------------------------
+class Stream {
+  public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual size_t write(uint8_t Data) = 0;
+};
+
+
+// -------------------------------------------------------------------------------------------------------------
+// Serial, printed to stdout. Set Text_Out to NULL to throw the output away
+// The bytes read and written as a Stream go to a file descriptor, Port, a pty for the streaming tests. -1 none
+// -------------------------------------------------------------------------------------------------------------
+class Host_Serial : public Stream {
+  public:
+    FILE *Text_Out = stdout;
+    int Port = -1;
+    void begin(unsigned long Baud) { (void)Baud; }
+    void print(const char *Text) { if (Text_Out != NULL) fputs(Text, Text_Out); }
+    void print(const String &Text) { print(Text.c_str()); }
+    void print(const __FlashStringHelper *Text) { print((const char *)Text); }
+    void print(char Value) { if (Text_Out != NULL) fputc(Value, Text_Out); }
+    void print(int Value) { if (Text_Out != NULL) fprintf(Text_Out, "%d", Value); }
+    void print(unsigned int Value) { if (Text_Out != NULL) fprintf(Text_Out, "%u", Value); }
+    void print(long Value) { if (Text_Out != NULL) fprintf(Text_Out, "%ld", Value); }
+    void print(unsigned long Value) { if (Text_Out != NULL) fprintf(Text_Out, "%lu", Value); }
+    void print(double Value) { if (Text_Out != NULL) fprintf(Text_Out, "%.2f", Value); }
+    int available() {
+      int Count = 0;
+      if (Port < 0 || ioctl(Port, FIONREAD, &Count) != 0) {
+        return 0;
+      }
+      return Count;
+    }
+    int read() {
+      uint8_t Data;
+      return (Port >= 0 && ::read(Port, &Data, 1) == 1) ? Data : -1;
+    }
+    size_t write(uint8_t Data) {
+      return (Port >= 0 && ::write(Port, &Data, 1) == 1) ? 1 : 0;
+    }
+    template <class T> void println(T Value) { print(Value); println(); }
+    void println() { print('\n'); }
+};
+
+static Host_Serial Serial;
+
+#endif
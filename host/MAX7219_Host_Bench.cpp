@@ -0,0 +1,1016 @@
+/*
+  Host benchmark for the display functions, runs on Linux against the simulated MAX7219 chain in MAX7219_Sim.h
+  The chain length is set at build time with -DNumber_MAX7219=N, see the Makefile, make bench runs 4 to 64 chips
+  Built with -DMAX7219_STATS the display statistics are printed under each workload and checked against the chain
+  Built with -DBench_Chains=K the display is split into K chains, each with its own CS pin, or with -DBench_Parallel=1
+  sharing CS with a DIN line each. The chips column shows the split, 64/4cs or 64/4p, and Bus/frame is the byte times
+  on the wire, chains sent together take the time of one
+  A second, short chain on its own CS pin shares the data line, it must be left untouched by all of the workloads
+  A tiled display, 2 rows of 4 modules on a third CS pin, is laid out several ways and every pixel the chips light is
+  checked against where the modules sit
+  The graphics, on the benchmarked display and the tiled one, are run a word at a time and a pixel at a time from the
+  same random frame buffer, the two must match, and both are timed
+
+  Each workload is run twice
+  - On the simulated chain, counting bytes, CS toggles and transactions per frame. After every frame the image the chips
+    would light is checked against Frame_Buffer, any frame that does not match is counted as bad
+  - On a transport that sends nothing, timing the render and flush code alone in uS per frame
+  Then full refreshes are timed sending a byte at a time and sending each transaction as one block, in frames/s
+
+  Returns 1 if any frame was bad or any transaction left the chain misaligned, so it can be used as a regression test
+*/
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <chrono>
+
+#include "../MAX7219_90_Deg_Demo/MAX7219_Functions.h"
+#include "MAX7219_Sim.h"
+#include "../MAX7219_90_Deg_Demo/MAX7219_Benchmark.h"
+
+#ifndef Number_MAX7219
+#define Number_MAX7219 4                          // Number of MAX7219 chips in the benchmarked chain
+#endif
+#ifndef Bench_Chains
+#define Bench_Chains 1                            // Chains the benchmarked display is split into
+#endif
+#ifndef Bench_Parallel
+#define Bench_Parallel 0                          // 1, the chains share CS with a DIN line each. 0, each chain has its own CS
+#endif
+#define Bench_CS 10                               // CS pin of the benchmarked chain
+#define Bench_Chain_CS 20                         // CS pin of the chains after the first, when each has its own
+#define Other_CS 9                                // CS pin of the second chain
+#define Tiled_CS 11                               // CS pin of the tiled display
+#define Reference_CS 8                            // CS pin of the reference display, never sent to, only its frame buffer is used
+#define Bench_Repeats 20                          // Times each workload is run for the timing
+#define Bench_Refreshes 20000                     // Full refreshes timed for each transfer mode
+#define Bench_Graphics_Ops 2000                   // Operations of each graphics test, checked and timed
+
+MAX7219_Matrix<Number_MAX7219, Bench_CS, Bench_Chains> Display;
+MAX7219_Matrix<2, Other_CS> Other_Display;
+MAX7219_Matrix<Number_MAX7219, Reference_CS> Reference;  // Draws the frames the strip scrolls should match
+uint8_t Strip_Buffer[512];                        // Column strip for the strip workloads
+MAX7219_Sim_Split Chain(Number_MAX7219, Bench_Chains, Bench_Parallel == 1);
+const MAX7219_Transport &Bench_Transport = (Bench_Parallel == 1) ? Sim_Parallel_Transport : Sim_Transport;
+char Bench_Name[16];                              // Chips and how they are split, for the table
+MAX7219_Sim_Chain Other_Chain(2);
+MAX7219_Matrix<8, Tiled_CS, 1, 2> Tiled;         // 2 rows of 4 modules, 32 x 16 pixels
+MAX7219_Sim_Chain Tiled_Chain(8);
+MAX7219_Matrix<8, Reference_CS, 1, 2> Tiled_Reference; // Draws the tiled display's graphics a pixel at a time
+bool Check_Frames = false;                        // true, check the simulated image after every frame
+unsigned long Frames = 0;                         // Frames written by the workload
+unsigned long Bad_Frames = 0;                     // Frames where the simulated image did not match Frame_Buffer
+
+
+// -----------------------------------------------------------------------------------------------------
+// Transport that sends nothing, used to time the display functions alone. Every byte is read, as a real
+// transport would to load the SPI data register or FIFO
+// -----------------------------------------------------------------------------------------------------
+volatile uint8_t Null_Sink = 0;
+
+void Null_Select(uint8_t Cs_Pin) {
+  (void)Cs_Pin;
+}
+
+void Null_Transfer(uint8_t Data) {
+  Null_Sink = Data;
+}
+
+void Null_Deselect(uint8_t Cs_Pin) {
+  (void)Cs_Pin;
+}
+
+void Null_Transfer_Block(uint8_t *Data, uint16_t Length) {
+  uint8_t Sum = 0;
+  for (uint16_t i = 0; i < Length; i++) {
+    Sum += Data[i];
+  }
+  Null_Sink = Sum;
+}
+
+void Null_Transfer_Lanes(uint8_t *Data, uint16_t Length, uint8_t Lanes) {
+  Null_Transfer_Block(Data, Length * Lanes);
+}
+
+const MAX7219_Transport Null_Transport = { Null_Select, Null_Transfer, Null_Deselect, Null_Transfer_Block,
+                                           (Bench_Parallel == 1) ? Null_Transfer_Lanes : NULL };
+
+
+// -------------------------------------------------------------------------
+// Check the simulated image against Frame_Buffer, a mismatch is a bad frame
+// -------------------------------------------------------------------------
+void Check_Image() {
+
+  if (Check_Frames == true) {
+    uint8_t Image[Number_MAX7219 * 8];
+    Chain.Visible_Image(Image);
+    if (memcmp(Image, Display.Frame_Buffer, sizeof(Image)) != 0) {
+      Bad_Frames++;
+    }
+  }
+
+} // end of function
+
+
+// ----------------------------------------------------------------------------------
+// Called by the workloads after every frame, counts it and checks the simulated image
+// ----------------------------------------------------------------------------------
+void Frame_Done() {
+
+  Frames++;
+  Check_Image();
+
+} // end of function
+
+
+// ---------------------------------------------------------------------------------------------------------------
+// Run the effects started by the workload in every zone and any queued messages to the end, moving the clock on to
+// each frame. Late_Every > 0, every Late_Every'th tick comes Late_Us after it was due, as a busy loop() would, and
+// frames are dropped. No zone's next frame may be due more than its frame period away, dropping must never move it
+// past now. The chips must be left showing the frame buffer once the effects have finished
+// ---------------------------------------------------------------------------------------------------------------
+void Run_Effect(int Late_Every = 0, unsigned long Late_Us = 0) {
+
+  int Ticks = 0;
+
+  while (Display.Animation_Any_Running() == true || Display.Queue_Pending() > 0) {
+    unsigned long Wait = Display.Animation_Tick();
+    for (int zz = 0; zz < MAX7219_Zones; zz++) {
+      MAX7219_Zone &Zone = Display.Zones[zz];
+      if (Zone.Effect_Type != Effect_None && (long)(Zone.Frame_Due - micros()) > (long)Zone.Frame_Period) {
+        Bad_Frames++;
+      }
+    } // end of loop
+    // The clock is always moved on to the due time, so every tick that leaves an effect running wrote a frame
+    if (Display.Animation_Any_Running() == true) {
+      Frame_Done();
+    }
+    Ticks++;
+    Host_Advance(Wait + ((Late_Every > 0 && (Ticks % Late_Every) == 0) ? Late_Us : 0));
+  } // end of loop
+
+  // The tick that ended the effects
+  Check_Image();
+
+} // end of function
+
+
+// ----------------------------------------------------------
+// Workloads, each runs one complete sequence from a clear display
+// ----------------------------------------------------------
+void Workload_Display_Text() {
+
+  // Clock style text, one second a frame so mostly just the last digit changes
+  for (int Seconds = 0; Seconds < 100; Seconds++) {
+    char Text[16];
+    snprintf(Text, sizeof(Text), "12:%02d:%02d", Seconds / 60, Seconds % 60);
+    Display.Display_Text(Text, 0);
+    Frame_Done();
+  } // end of loop
+
+} // end of function
+
+// -------------------------------------------------------------------------------------------------------------------
+// The same clock as a counter, the changed cells drawn and their modules sent. Fixed width the counter must draw what
+// Write_Text would, checked after every second and after every roll on the simulated chain. Late_Every > 0, every
+// Late_Every'th tick of a roll is 5 frame periods late
+// -------------------------------------------------------------------------------------------------------------------
+void Run_Counter(int Roll_Speed, int Late_Every = 0) {
+
+  Display.Counter_Start(0, 0, Roll_Speed);
+
+  for (int Seconds = 0; Seconds < 100; Seconds++) {
+
+    char Text[16];
+    snprintf(Text, sizeof(Text), "12:%02d:%02d", Seconds / 60, Seconds % 60);
+    Display.Counter_Show(Text);
+    Frame_Done();
+    Run_Effect(Late_Every, 5000UL * Roll_Speed);
+
+    if (Check_Frames == true) {
+      Reference.Clear_Buffer();
+      Reference.Column = 0;
+      Reference.Write_Text(Text);
+      if (memcmp(Display.Frame_Buffer, Reference.Frame_Buffer, sizeof(Display.Frame_Buffer)) != 0) {
+        Bad_Frames++;
+      }
+    }
+
+  } // end of loop
+
+  // Changed again part way through a roll, the cut short cells go straight to their new characters
+  if (Roll_Speed > 0) {
+    Display.Counter_Show("12:34:56");
+    Host_Advance(0);
+    Display.Animation_Tick();
+    Host_Advance((unsigned long)Roll_Speed * 3000);
+    Display.Animation_Tick();
+    Display.Counter_Show("12:34:57");
+    Frame_Done();
+    Reference.Clear_Buffer();
+    Reference.Column = 0;
+    Reference.Write_Text("12:34:57");
+    int Still = ((Display.Tiles_X < 7) ? Display.Tiles_X : 7) * 8;  // Cells 0 to 6 are not rolling
+    if (Check_Frames == true && memcmp(Display.Frame_Buffer, Reference.Frame_Buffer, Still) != 0) {
+      Bad_Frames++;
+    }
+    Run_Effect();
+    if (Check_Frames == true && memcmp(Display.Frame_Buffer, Reference.Frame_Buffer, sizeof(Display.Frame_Buffer)) != 0) {
+      Bad_Frames++;
+    }
+  }
+
+} // end of function
+
+void Workload_Counter() {
+
+  Run_Counter(0);
+
+} // end of function
+
+void Workload_Counter_Roll() {
+
+  Run_Counter(20);
+
+} // end of function
+
+void Workload_Counter_Roll_Late() {
+
+  // The late tick lands on different frames of the roll, some on the last
+  for (int Late_Every = 3; Late_Every <= 6; Late_Every++) {
+    Run_Counter(20, Late_Every);
+  } // end of loop
+
+} // end of function
+
+void Workload_Wipe_Left() {
+
+  Display.Wipe_Text_Left_Start("Right", 4);
+  Run_Effect();
+
+} // end of function
+
+void Workload_Wipe_Right() {
+
+  Display.Wipe_Text_Right_Start("In from Left", 8);
+  Run_Effect();
+
+} // end of function
+
+void Workload_Scroll() {
+
+  Display.Scroll_Incremental = true;
+  Display.Scroll_Text_Start("Scrolling text right to left.....", 10);
+  Run_Effect();
+
+} // end of function
+
+void Workload_Late_Ticks() {
+
+  // Ticks 2 to 5 frame periods late, often enough that some land on the last frames of each effect
+  for (int Late = 2; Late <= 5; Late++) {
+    Display.Wipe_Text_Left_Start("Right", 4);
+    Run_Effect(3, Late * 4000UL);
+    Display.Wipe_Text_Right_Start("In", 4);
+    Run_Effect(2, Late * 4000UL);
+    Display.Scroll_Incremental = true;
+    Display.Scroll_Text_Start("Late", 4);
+    Run_Effect(3, Late * 4000UL);
+  } // end of loop
+
+} // end of function
+
+void Workload_Scroll_Proportional() {
+
+  Display.Proportional = true;
+  Display.Scroll_Text_Start("Scrolling text right to left.....", 10);
+  Run_Effect();
+  Display.Proportional = false;
+
+} // end of function
+
+void Workload_Queue() {
+
+  Display.Queue_Message(F("Queued scroll"), Effect_Scroll, 10);
+  Display.Queue_Message("Wipe", Effect_Wipe_Left, 4);
+  Display.Queue_Message(F("Hold"), Effect_Hold, 1000);
+  Run_Effect();
+
+} // end of function
+
+void Workload_Zones() {
+
+  // A short wipe at the left, a scroll at a different speed in the rest of the display. The split is part way into
+  // the second chip so both zones share it, and the wipe text is wider than its zone so it must be clipped
+  int Split = 11;
+  Display.Zone_Define(0, 0, Split);
+  Display.Zone_Define(1, Split, Display.Columns - Split);
+  Display.Wipe_Text_Left_Start("12:34", 6, 0);
+  Display.Scroll_Text_Start("Zoned scroll", 10, 1);
+  Run_Effect();
+
+  // The scroll has gone off the left of its zone and must not have drawn into zone 0, which is left showing the wipe
+  for (int i = Split; i < Display.Columns; i++) {
+    for (uint8_t ii = 0; ii < 8; ii++) {
+      if (bitRead(Display.Frame_Buffer[((i / 8) * 8) + ii], i & 0x07) == 1) {
+        Bad_Frames++;
+      }
+    } // end of row loop
+  } // end of column loop
+
+  uint8_t Wiped[Number_MAX7219 * 8];
+  memcpy(Wiped, Display.Frame_Buffer, sizeof(Wiped));
+  Display.Display_Text("12:34", 0, 0);
+  if (memcmp(Wiped, Display.Frame_Buffer, sizeof(Wiped)) != 0) {
+    Bad_Frames++;
+  }
+  Frame_Done();
+
+  Display.Zone_Define(0, 0, Display.Columns);
+  Display.Zone_Define(1, 0, 0);
+
+} // end of function
+
+// ---------------------------------------------------------------------------------------------------------------
+// Run a strip scroll for up to Frame_Limit frames, checking each frame against the message written by Write_Text at
+// the same position, and again every period along for a marquee
+// ---------------------------------------------------------------------------------------------------------------
+void Run_Strip_Scroll(const char *Text, unsigned long Frame_Limit) {
+
+  MAX7219_Zone &Zone = Display.Zones[0];
+  int Position = Zone.Scroll_Position;            // Position the next frame is drawn at, without the marquee wrap
+  int Period = Zone.Strip_Period;
+  unsigned long Frame_Count = 0;
+
+  Reference.Proportional = Display.Proportional;
+
+  while (Display.Animation_Running() == true && Frame_Count < Frame_Limit) {
+    unsigned long Wait = Display.Animation_Tick();
+    if (Display.Animation_Running() == true && Check_Frames == true) {
+      Reference.Clear_Buffer();
+      for (int Start = Position; Start < Display.Columns; Start += Period) {
+        Reference.Column = Start;
+        Reference.Write_Text(Text);
+        if (Zone.Marquee == false) {
+          break;
+        }
+      } // end of loop
+      if (memcmp(Reference.Frame_Buffer, Display.Frame_Buffer, sizeof(Display.Frame_Buffer)) != 0) {
+        Bad_Frames++;
+      }
+    }
+    if (Display.Animation_Running() == true) {
+      Frame_Done();
+      Frame_Count++;
+      Position--;
+    }
+    Host_Advance(Wait);
+  } // end of loop
+
+  Display.Animation_Stop();
+
+} // end of function
+
+void Workload_Scroll_Strip() {
+
+  const char *Text = "Scrolling text right to left.....";
+  Display.Strip_Attach(0, Strip_Buffer, sizeof(Strip_Buffer));
+  Display.Scroll_Text_Start(Text, 10);
+  if (Display.Zones[0].Strip_Ready == false) {
+    Bad_Frames++;
+  }
+  Run_Strip_Scroll(Text, 100000);
+
+  // The same text again scrolls from the strip already rendered
+  Display.Scroll_Text_Start(Text, 10);
+  Run_Strip_Scroll(Text, 100000);
+  Display.Strip_Attach(0, NULL, 0);
+
+} // end of function
+
+void Workload_Marquee() {
+
+  // Proportional with a gap the width of a space, three times round on the longest chain
+  const char *Text = "Marquee loops with no gap.";
+  Display.Proportional = true;
+  Display.Zones[0].Marquee = true;
+  Display.Zones[0].Marquee_Gap = Space_Width;
+  Display.Strip_Attach(0, Strip_Buffer, sizeof(Strip_Buffer));
+  Display.Scroll_Text_Start(Text, 10);
+  Run_Strip_Scroll(Text, 3 * (Display.Columns + Display.Zones[0].Strip_Period));
+  Display.Strip_Attach(0, NULL, 0);
+  Display.Zones[0].Marquee = false;
+  Display.Proportional = false;
+
+} // end of function
+
+void Workload_Resync() {
+
+  // Brightness set again at the level it already is sends nothing
+  unsigned long Bytes = Chain.Bytes();
+  for (int i = 0; i < 10; i++) {
+    Display.MAX7219_All_Chips(MAX7219_Intensity, 0x02);
+  } // end of loop
+  if (Chain.Bytes() != Bytes) {
+    Bad_Frames++;
+  }
+
+  Display.Display_Text("Heal me", 0);
+  Frame_Done();
+
+  // Noise, a chip falls into display test, another shuts down and a third loses a digit register
+  if (Check_Frames == true) {
+    Chain.Upset(0, MAX7219_Displaytest, 0x01);
+    Chain.Upset(Number_MAX7219 - 1, MAX7219_Shutdown, 0x00);
+    Chain.Upset(Number_MAX7219 / 2, 3, 0x5A);
+  }
+
+  // Every register has been sent again after one round of steps, each step is counted as a frame
+  bool Check = Check_Frames;
+  Check_Frames = false;
+  for (int Step = 0; Step < MAX7219_Resync_Steps; Step++) {
+    Display.Resync_Step();
+    Frame_Done();
+  } // end of loop
+  Check_Frames = Check;
+  Frame_Done();
+
+} // end of function
+
+void Workload_Scroll_Rerender() {
+
+  Display.Scroll_Incremental = false;
+  Display.Scroll_Text_Start("Scrolling text right to left.....", 10);
+  Run_Effect();
+  Display.Scroll_Incremental = true;
+
+} // end of function
+
+
+// ---------------------------------------------------------------------------------------------------------------
+// Change from a message to a picture drawn in the reference display and back with a transition, the display must
+// end showing each picture exactly. Late_Every > 0, every Late_Every'th tick is 5 frame periods late
+// ---------------------------------------------------------------------------------------------------------------
+void Run_Transition(uint8_t Type, int Late_Every = 0) {
+
+  Display.Display_Text("From", 0);
+  Frame_Done();
+
+  Reference.Clear_Buffer();
+  Reference.Column = 2;
+  Reference.Write_Text("To..");
+  Reference.Draw_Rect(0, 0, Reference.Columns, 8, Pixel_Invert);
+  Display.Transition_Start(Reference.Frame_Buffer, Type, 20);
+  Run_Effect(Late_Every, 5 * 20000UL);
+  if (memcmp(Display.Frame_Buffer, Reference.Frame_Buffer, sizeof(Display.Frame_Buffer)) != 0) {
+    Bad_Frames++;
+  }
+
+  Reference.Clear_Buffer();
+  Display.Transition_Start(Reference.Frame_Buffer, Type, 20);
+  Run_Effect(Late_Every, 5 * 20000UL);
+  if (memcmp(Display.Frame_Buffer, Reference.Frame_Buffer, sizeof(Display.Frame_Buffer)) != 0) {
+    Bad_Frames++;
+  }
+
+} // end of function
+
+void Workload_Slide() {
+
+  Run_Transition(Effect_Slide_Up);
+  Run_Transition(Effect_Slide_Down);
+
+} // end of function
+
+void Workload_Dissolve() {
+
+  Run_Transition(Effect_Dissolve);
+
+} // end of function
+
+void Workload_Transition_Late() {
+
+  // The late tick lands part way through or on the last frames
+  for (int Late_Every = 3; Late_Every <= 6; Late_Every++) {
+    Run_Transition(Effect_Slide_Up, Late_Every);
+    Run_Transition(Effect_Slide_Down, Late_Every);
+    Run_Transition(Effect_Dissolve, Late_Every);
+  } // end of loop
+
+} // end of function
+
+
+// -------------------------------------------------------------------------------------------------------------------
+// Check every pixel the tiled chain lights against the frame buffer, the chips placed as given. Module pixel b of
+// digit 8 - i is turned round to the display as the module is, worked out here apart from the display's own tables
+// -------------------------------------------------------------------------------------------------------------------
+bool Tiled_Matches(const int *Tile_X, const int *Tile_Y, const uint8_t *Orientation) {
+
+  for (int Chip = 0; Chip < 8; Chip++) {
+    for (int i = 0; i < 8; i++) {
+      uint8_t Data = Tiled_Chain.Visible_Digit(Chip, 8 - i);
+      for (int b = 0; b < 8; b++) {
+        int X = b, Y = i;
+        switch (Orientation[Chip]) {
+          case Tile_270: X = 7 - b; Y = 7 - i; break;
+          case Tile_0: X = 7 - i; Y = b; break;
+          case Tile_180: X = i; Y = 7 - b; break;
+        }
+        if (bitRead(Data, b) != (Tiled.Pixel_Get((Tile_X[Chip] * 8) + X, (Tile_Y[Chip] * 8) + Y) ? 1 : 0)) {
+          return false;
+        }
+      } // end of bit loop
+    } // end of digit loop
+  } // end of chip loop
+
+  return (Tiled_Chain.Misaligned_Latches == 0);
+
+} // end of function
+
+
+// ---------------------------------------------------------------------------------------------------------------
+// Lay the tiled display out row by row, serpentine, with quarter turned modules and mixed, draw on it and check it
+// Returns the layouts that did not match
+// ---------------------------------------------------------------------------------------------------------------
+int Bench_Tiled() {
+
+  struct { const char *Name; bool Serpentine; uint8_t Orientation; int Mixed_Chip; } Layouts[] = {
+    { "rows", false, Tile_90, -1 },
+    { "serpentine", true, Tile_90, -1 },
+    { "serpentine 0", true, Tile_0, -1 },
+    { "mixed", true, Tile_90, 5 },
+  };
+
+  int Failures = 0;
+
+  for (unsigned int l = 0; l < sizeof(Layouts) / sizeof(Layouts[0]); l++) {
+
+    // Where each chip should be, chip 0 top left. Serpentine rows run back and are upside down
+    int Tile_X[8], Tile_Y[8];
+    uint8_t Orientation[8];
+    for (int Chip = 0; Chip < 8; Chip++) {
+      bool Reversed = (Layouts[l].Serpentine == true && Chip >= 4);
+      Tile_Y[Chip] = Chip / 4;
+      Tile_X[Chip] = (Reversed == true) ? 3 - (Chip % 4) : Chip % 4;
+      Orientation[Chip] = (Reversed == true) ? (Layouts[l].Orientation + 2) % 4 : Layouts[l].Orientation;
+    } // end of loop
+
+    Tiled.Layout_Tiles(Layouts[l].Serpentine, Layouts[l].Orientation);
+    if (Layouts[l].Mixed_Chip >= 0) {
+      Orientation[Layouts[l].Mixed_Chip] = Tile_0;
+      Tiled.Layout_Chip(Layouts[l].Mixed_Chip, Tile_X[Layouts[l].Mixed_Chip], Tile_Y[Layouts[l].Mixed_Chip], Tile_0);
+    }
+
+    // A border and a diagonal drawn a pixel at a time, text in each row of modules
+    Tiled.Clear_Buffer();
+    for (int X = 0; X < Tiled.Columns; X++) {
+      Tiled.Pixel_Set(X, 0, true);
+      Tiled.Pixel_Set(X, Tiled.Height - 1, true);
+      Tiled.Pixel_Set(X, (X * Tiled.Height) / Tiled.Columns, true);
+    } // end of loop
+    for (int Y = 0; Y < Tiled.Height; Y++) {
+      Tiled.Pixel_Set(0, Y, true);
+      Tiled.Pixel_Set(Tiled.Columns - 1, Y, true);
+    } // end of loop
+    Tiled.Display_Update();
+    bool Match = Tiled_Matches(Tile_X, Tile_Y, Orientation);
+
+    Tiled.Zone_Define(0, 0, Tiled.Columns, 0);
+    Tiled.Zone_Define(1, 0, Tiled.Columns, 1);
+    Tiled.Display_Text("Top", 1, 0);
+    Tiled.Display_Text("Bot", 1, 1);
+    Match = Match && Tiled_Matches(Tile_X, Tile_Y, Orientation);
+
+    // The bottom row of modules holds the text as a one row display would
+    MAX7219_Matrix<4, Reference_CS> Row_Text;
+    Row_Text.Column = 1;
+    Row_Text.Write_Text("Bot");
+    Match = Match && memcmp(&Tiled.Frame_Buffer[Tiled.Columns], Row_Text.Frame_Buffer, sizeof(Row_Text.Frame_Buffer)) == 0;
+
+    // A counter in the bottom row, the changed cell's module found and sent wherever the chip is
+    Tiled.Counter_Start(1, 1);
+    Tiled.Counter_Show("Bot");
+    Tiled.Counter_Show("B0t");
+    Match = Match && Tiled_Matches(Tile_X, Tile_Y, Orientation);
+
+    printf("%6s  Tiled %-16s %dx%d  %s\n", "8/2r", Layouts[l].Name, Tiled.Columns, Tiled.Height, Match ? "ok" : "FAIL");
+    if (Match == false) {
+      Failures++;
+    }
+
+  } // end of layout loop
+
+  return Failures;
+
+} // end of function
+
+
+// ------------------------------------------------------------------------------------------------------------------
+// The parallel transport of the sketch on the host's pins, which only remember the last level. Each lane's DIN must
+// be left at the last bit of its data and CLK low, with the DIN pins on one port and spread over two. A transfer with
+// more lanes than DIN pins, or before the pins are set, must not be sent. Prints one line, returns the failures
+// ------------------------------------------------------------------------------------------------------------------
+int Bench_Parallel_Pins() {
+
+  const uint8_t Layouts[2][4] = { { 2, 3, 4, 5 }, { 2, 3, 9, 10 } };
+  uint8_t Data[4] = { 0x81, 0x02, 0x43, 0x04 };   // Lane k sends Data[3 - k], the chain on the left last
+  bool Match = true;
+
+  unsigned long Refused = Parallel_Refused;
+  MAX7219_Parallel_Transport.Transfer_Lanes(Data, 1, 4);
+  Match = Match && (Parallel_Refused == Refused + 1);
+
+  for (int l = 0; l < 2; l++) {
+    MAX7219_Parallel_Pins(14, Layouts[l], 4);
+    for (int Pass = 0; Pass < 2; Pass++) {
+      MAX7219_Parallel_Transport.Transfer_Lanes(Data, 1, 4);
+      for (int k = 0; k < 4; k++) {
+        Match = Match && (digitalRead(Layouts[l][k]) == bitRead(Data[3 - k], 0));
+        Data[3 - k] ^= 0x01;
+      } // end of loop
+      Match = Match && (digitalRead(14) == LOW);
+    } // end of loop
+  } // end of loop
+
+  Refused = Parallel_Refused;
+  MAX7219_Parallel_Pins(14, Layouts[0], 2);
+  MAX7219_Parallel_Transport.Transfer_Lanes(Data, 1, 4);
+  Match = Match && (Parallel_Refused == Refused + 1);
+  Parallel_Lanes = 0;
+
+  printf("%6s  Parallel transport pins  %s\n", "4p", Match ? "ok" : "FAIL");
+  return (Match == true) ? 0 : 1;
+
+} // end of function
+
+
+// ----------------------------------------------------------------------------------------------------------------
+// Run a graphics operation on two displays of the same size and layout, a word at a time on Word_Display and a pixel at a time
+// on Pixel_Display (MAX7219_Benchmark.h), from the same random frame buffer, checking they match after every one.
+// Then time each way, print one line and return true if they always matched
+// ----------------------------------------------------------------------------------------------------------------
+template <class Matrix, class Pixel_Matrix> bool Bench_Graphics_Op(Matrix &Word_Display, Pixel_Matrix &Pixel_Display, uint8_t Which, const char *Name) {
+
+  bool Match = true;
+  for (int a = 0; a < Matrix::Buffer_Size; a++) {
+    Word_Display.Frame_Buffer[a] = (uint8_t)rand();
+  } // end of loop
+  memcpy(Pixel_Display.Frame_Buffer, Word_Display.Frame_Buffer, Matrix::Buffer_Size);
+
+  for (int i = 0; i < Bench_Graphics_Ops; i++) {
+    Benchmark_Graphics_Op(Word_Display, Which, true, i);
+    Benchmark_Graphics_Op(Pixel_Display, Which, false, i);
+    if (memcmp(Word_Display.Frame_Buffer, Pixel_Display.Frame_Buffer, Matrix::Buffer_Size) != 0) {
+      Match = false;
+    }
+    // The scroll empties the frame buffer, start again from a new picture
+    if (Which == Benchmark_Graphics_Scroll && (i % 4) == 3) {
+      for (int a = 0; a < Matrix::Buffer_Size; a++) {
+        Word_Display.Frame_Buffer[a] = (uint8_t)rand();
+      } // end of loop
+      memcpy(Pixel_Display.Frame_Buffer, Word_Display.Frame_Buffer, Matrix::Buffer_Size);
+    }
+  } // end of loop
+
+  double Time_Us[2];
+  for (int Word = 0; Word < 2; Word++) {
+    std::chrono::steady_clock::time_point Start = std::chrono::steady_clock::now();
+    for (int i = 0; i < Bench_Graphics_Ops; i++) {
+      if (Word == 1) {
+        Benchmark_Graphics_Op(Word_Display, Which, true, i);
+      }
+      else {
+        Benchmark_Graphics_Op(Pixel_Display, Which, false, i);
+      }
+    } // end of loop
+    std::chrono::steady_clock::time_point End = std::chrono::steady_clock::now();
+    Time_Us[Word] = std::chrono::duration<double, std::micro>(End - Start).count() / Bench_Graphics_Ops;
+  } // end of loop
+
+  printf("%6s  Graphics %-16s word %8.3f uS, pixel %8.3f uS (%.1fx)  %s\n", Name, Benchmark_Graphics_Names[Which],
+         Time_Us[1], Time_Us[0], Time_Us[0] / ((Time_Us[1] > 0) ? Time_Us[1] : 1), Match ? "ok" : "FAIL");
+
+  return Match;
+
+} // end of function
+
+
+// -----------------------------------------------------------------------------------------------------------------
+// The graphics the benchmark does not time, each checked against the same drawn a pixel at a time. Returns true if
+// they all match
+// -----------------------------------------------------------------------------------------------------------------
+template <class Matrix, class Pixel_Matrix> bool Graphics_Matches(Matrix &Word_Display, Pixel_Matrix &Pixel_Display) {
+
+  bool Match = true;
+  const uint8_t Mask[24] = { 0xFF, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x0F, 0x00, 0xF0, 0x01,
+                             0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x3C, 0x00, 0xFF, 0x01, 0x81, 0x01 };
+
+  for (int i = 0; i < 200; i++) {
+
+    for (int a = 0; a < Matrix::Buffer_Size; a++) {
+      Word_Display.Frame_Buffer[a] = (uint8_t)rand();
+    } // end of loop
+    memcpy(Pixel_Display.Frame_Buffer, Word_Display.Frame_Buffer, Matrix::Buffer_Size);
+
+    // Scroll down, the scroll up backwards
+    int Count = 1 + (i % (Matrix::Height + 2));
+    Word_Display.Scroll_Buffer_Down(Count);
+    for (int yy = Matrix::Height - 1; yy >= 0; yy--) {
+      for (int xx = 0; xx < Matrix::Columns; xx++) {
+        Pixel_Display.Pixel_Set(xx, yy, (yy - Count >= 0) ? Pixel_Display.Pixel_Get(xx, yy - Count) : false);
+      }
+    } // end of row loop
+
+    // A masked sprite
+    Word_Display.Draw_Sprite((i % (Matrix::Columns + 8)) - 8, (i % (Matrix::Height + 8)) - 8, Benchmark_Sprite, Mask, 9, 12);
+    Draw_Sprite_Pixelwise(Pixel_Display, (i % (Matrix::Columns + 8)) - 8, (i % (Matrix::Height + 8)) - 8, Benchmark_Sprite, Mask, 9, 12);
+
+    // Lines across, down and on a slope, and a rectangle outline, all inverting so any pixel drawn twice shows
+    int X0 = (i * 7) % Matrix::Columns, Y0 = (i * 3) % Matrix::Height;
+    int X1 = (i * 13) % Matrix::Columns, Y1 = (i * 5) % Matrix::Height;
+    Word_Display.Draw_Line(X0, Y0, X1, Y0, Pixel_Invert);
+    Word_Display.Draw_Line(X0, Y0, X0, Y1, Pixel_Invert);
+    Word_Display.Draw_Line(X0, Y0, X1, Y1, Pixel_Invert);
+    Word_Display.Draw_Rect(X0 - 1, Y1 - 2, (i % 11), (i % 9), Pixel_Invert);
+    for (int xx = (X0 < X1 ? X0 : X1); xx <= (X0 < X1 ? X1 : X0); xx++) {
+      Pixel_Display.Pixel_Draw(xx, Y0, Pixel_Invert);
+    }
+    for (int yy = (Y0 < Y1 ? Y0 : Y1); yy <= (Y0 < Y1 ? Y1 : Y0); yy++) {
+      Pixel_Display.Pixel_Draw(X0, yy, Pixel_Invert);
+    }
+    if (X0 == X1 || Y0 == Y1) {
+      Fill_Rect_Pixelwise(Pixel_Display, X0 < X1 ? X0 : X1, Y0 < Y1 ? Y0 : Y1, abs(X1 - X0) + 1, abs(Y1 - Y0) + 1, Pixel_Invert);
+    }
+    else {
+      // Bresenham, each step moves one or both ways
+      int Dx = abs(X1 - X0), Dy = -abs(Y1 - Y0), Error = Dx + Dy, X = X0, Y = Y0;
+      while (true) {
+        Pixel_Display.Pixel_Draw(X, Y, Pixel_Invert);
+        if (X == X1 && Y == Y1) {
+          break;
+        }
+        int Error_2 = 2 * Error;
+        if (Error_2 >= Dy) {
+          Error += Dy;
+          X += (X0 < X1) ? 1 : -1;
+        }
+        if (Error_2 <= Dx) {
+          Error += Dx;
+          Y += (Y0 < Y1) ? 1 : -1;
+        }
+      } // end of loop
+    }
+    for (int yy = Y1 - 2; yy < Y1 - 2 + (i % 9); yy++) {
+      for (int xx = X0 - 1; xx < X0 - 1 + (i % 11); xx++) {
+        if (yy == Y1 - 2 || yy == Y1 - 3 + (i % 9) || xx == X0 - 1 || xx == X0 - 2 + (i % 11)) {
+          Pixel_Display.Pixel_Draw(xx, yy, Pixel_Invert);
+        }
+      }
+    } // end of row loop
+
+    if (memcmp(Word_Display.Frame_Buffer, Pixel_Display.Frame_Buffer, Matrix::Buffer_Size) != 0) {
+      Match = false;
+    }
+
+  } // end of loop
+
+  return Match;
+
+} // end of function
+
+
+// -------------------------------------------------------------------------------------------------
+// Check and time the graphics on a display and its pixel at a time twin, returns the failures
+// -------------------------------------------------------------------------------------------------
+template <class Matrix, class Pixel_Matrix> int Bench_Graphics(Matrix &Word_Display, Pixel_Matrix &Pixel_Display, const char *Name) {
+
+  int Failures = 0;
+
+  srand(Matrix::Buffer_Size);
+  for (uint8_t Which = 0; Which < 4; Which++) {
+    if (Bench_Graphics_Op(Word_Display, Pixel_Display, Which, Name) == false) {
+      Failures++;
+    }
+  } // end of loop
+
+  bool Match = Graphics_Matches(Word_Display, Pixel_Display);
+  printf("%6s  Graphics %-16s %s\n", Name, "lines and masks", Match ? "ok" : "FAIL");
+  if (Match == false) {
+    Failures++;
+  }
+
+  Word_Display.Clear_Buffer();
+  return Failures;
+
+} // end of function
+
+
+// ------------------------------------------------------------------------------------------
+// Run one workload on the simulated chain and again for timing, print one line of the results
+// ------------------------------------------------------------------------------------------
+void Bench_Workload(const char *Name, void (*Workload)()) {
+
+  // Wire activity, from a clear display
+  MAX7219_Set_Transport(Bench_Transport);
+  Display.Clear_All();
+  Chain.Reset_Counters();
+  Sim_Bus_Bytes = 0;
+#ifdef MAX7219_STATS
+  Display.Stats_Reset();
+#endif
+  Sim_Transfer_Calls = 0;
+  Frames = 0;
+  Bad_Frames = 0;
+  Check_Frames = true;
+
+  Workload();
+
+  Check_Frames = false;
+  unsigned long Sim_Frames = (Frames > 0) ? Frames : 1;
+
+#ifdef MAX7219_STATS
+  // The statistics must count what reached the chain, they are printed under the table line
+  MAX7219_Stats Sim_Stats = Display.Stats;
+  if (Sim_Stats.Bytes != Chain.Bytes() || Sim_Stats.Transactions != Chain.Transactions()) {
+    Bad_Frames++;
+  }
+  // Sending moves the clock on Sim_Byte_Us a byte and drawing text Host_Flash_Read_Us a font byte, so the stage times
+  // are known. Send is exactly the bytes on the wire, Update the part of that sent by the updates, and a character
+  // read at least one font byte
+  if (Sim_Stats.Send.Total != Sim_Bus_Bytes * Sim_Byte_Us || (Sim_Stats.Transactions > 0 && Sim_Stats.Send.Max == 0) ||
+      Sim_Stats.Update.Total > Sim_Stats.Send.Total || (Sim_Stats.Update.Count > 0 && Sim_Stats.Update.Max == 0) ||
+      Sim_Stats.Character.Total < Sim_Stats.Character.Count) {
+    Bad_Frames++;
+  }
+#endif
+
+  // Render time, the same workload with nothing sent
+  MAX7219_Set_Transport(Null_Transport);
+  Display.Clear_All();
+  Frames = 0;
+
+  std::chrono::steady_clock::time_point Start = std::chrono::steady_clock::now();
+  for (int i = 0; i < Bench_Repeats; i++) {
+    Workload();
+  } // end of loop
+  std::chrono::steady_clock::time_point End = std::chrono::steady_clock::now();
+
+  double Render_Us = std::chrono::duration<double, std::micro>(End - Start).count() / ((Frames > 0) ? Frames : 1);
+
+  printf("%6s  %-16s %7lu %10.1f %9.1f %9.2f %12.2f %11.2f %10.3f  %s\n", Bench_Name, Name, Sim_Frames,
+         (double)Chain.Bytes() / Sim_Frames, (double)Sim_Bus_Bytes / Sim_Frames, (double)Chain.Cs_Toggles() / Sim_Frames, (double)Chain.Transactions() / Sim_Frames,
+         (double)Sim_Transfer_Calls / Sim_Frames, Render_Us, (Bad_Frames == 0 && Chain.Misaligned_Latches() == 0) ? "ok" : "FAIL");
+
+#ifdef MAX7219_STATS
+  Serial.Text_Out = stdout;
+  Serial.print("       Stats ");
+  Display.Stats = Sim_Stats;
+  Display.Stats_Report();
+  Serial.Text_Out = NULL;
+#endif
+
+} // end of function
+
+
+// -------------------------------------------------------------------------------------------------
+// Full refreshes per second on the null transport, Bulk = true sends each transaction as one block
+// -------------------------------------------------------------------------------------------------
+double Bench_Refresh(bool Bulk) {
+
+  MAX7219_Set_Transport(Null_Transport);
+  Display.Bulk_Transfer = Bulk;
+
+  std::chrono::steady_clock::time_point Start = std::chrono::steady_clock::now();
+  for (int i = 0; i < Bench_Refreshes; i++) {
+    Display.Display_Refresh();
+  } // end of loop
+  std::chrono::steady_clock::time_point End = std::chrono::steady_clock::now();
+
+  Display.Bulk_Transfer = true;
+
+  return Bench_Refreshes / std::chrono::duration<double>(End - Start).count();
+
+} // end of function
+
+
+int main() {
+
+  // Nothing the library prints over Serial may get into the table
+  Serial.Text_Out = NULL;
+
+#ifdef MAX7219_STATS
+  // Sending and drawing take time, for the statistics to measure
+  Sim_Byte_Us = 1;
+  Host_Flash_Read_Us() = 1;
+#endif
+
+  if (Bench_Chains == 1) {
+    snprintf(Bench_Name, sizeof(Bench_Name), "%d", Number_MAX7219);
+  }
+  else {
+    snprintf(Bench_Name, sizeof(Bench_Name), "%d/%d%s", Number_MAX7219, Bench_Chains, (Bench_Parallel == 1) ? "p" : "cs");
+  }
+
+  // Power up the simulated chains, as setup() in the sketch. The split chains either share CS with a DIN lane each
+  // or share the DIN with a CS each
+  MAX7219_Set_Transport(Bench_Transport);
+  for (int k = 0; k < Bench_Chains; k++) {
+    if (Bench_Parallel == 1) {
+      MAX7219_Sim_Attach(Bench_CS, &Chain.Part(k), k);
+    }
+    else {
+      Display.Chain_Cs[k] = (k == 0) ? Bench_CS : (Bench_Chain_CS + k);
+      MAX7219_Sim_Attach(Display.Chain_Cs[k], &Chain.Part(k));
+    }
+  } // end of loop
+  MAX7219_Sim_Attach(Other_CS, &Other_Chain);
+  MAX7219_Sim_Attach(Tiled_CS, &Tiled_Chain);
+  Display.MAX7219_Init();
+  Display.Clear_All();
+  Other_Display.MAX7219_Init();
+  Other_Display.Display_Text("Hi", 0);
+
+  unsigned long Failures = 0;
+  uint8_t Image[Number_MAX7219 * 8];
+  Chain.Visible_Image(Image);
+  if (memcmp(Image, Display.Frame_Buffer, sizeof(Image)) != 0 || Chain.Misaligned_Latches() != 0) {
+    printf("Chain does not match the frame buffer after MAX7219_Init\n");
+    Failures++;
+  }
+
+  printf(" Chips  Workload          Frames Bytes/frame Bus/frame  CS/frame  Trans/frame Calls/frame   uS/frame  Check\n");
+
+  struct { const char *Name; void (*Workload)(); } Workloads[] = {
+    { "Display_Text", Workload_Display_Text },
+    { "Counter", Workload_Counter },
+    { "Counter roll", Workload_Counter_Roll },
+    { "Counter late", Workload_Counter_Roll_Late },
+    { "Wipe_Text_Left", Workload_Wipe_Left },
+    { "Wipe_Text_Right", Workload_Wipe_Right },
+    { "Scroll", Workload_Scroll },
+    { "Scroll rerender", Workload_Scroll_Rerender },
+    { "Scroll prop", Workload_Scroll_Proportional },
+    { "Scroll strip", Workload_Scroll_Strip },
+    { "Marquee", Workload_Marquee },
+    { "Message queue", Workload_Queue },
+    { "Late ticks", Workload_Late_Ticks },
+    { "Zones", Workload_Zones },
+    { "Resync", Workload_Resync },
+    { "Slide", Workload_Slide },
+    { "Dissolve", Workload_Dissolve },
+    { "Transition late", Workload_Transition_Late },
+  };
+
+  for (unsigned int i = 0; i < sizeof(Workloads) / sizeof(Workloads[0]); i++) {
+    Bench_Workload(Workloads[i].Name, Workloads[i].Workload);
+    if (Bad_Frames != 0 || Chain.Misaligned_Latches() != 0) {
+      Failures++;
+    }
+  } // end of loop
+
+  double Byte_Rate = Bench_Refresh(false);
+  double Bulk_Rate = Bench_Refresh(true);
+  printf("%6s  Display_Refresh frames/s, byte at a time %.0f, block %.0f (%.2fx)\n", Bench_Name, Byte_Rate, Bulk_Rate,
+         Bulk_Rate / Byte_Rate);
+
+  // The tiled display, on the simulated chain again
+  MAX7219_Set_Transport(Bench_Transport);
+  Tiled.MAX7219_Init();
+  Failures += Bench_Tiled();
+
+  // The graphics, the display's frame buffer only, the chain is sent the cleared frame after
+  Failures += Bench_Graphics(Display, Reference, Bench_Name);
+  Failures += Bench_Graphics(Tiled, Tiled_Reference, "8/2r");
+  MAX7219_Set_Transport(Bench_Transport);
+  Display.Display_Update();
+
+  Failures += Bench_Parallel_Pins();
+
+  // The split display on its own parallel transport, the shared one without lanes as the other displays would have
+  if (Bench_Parallel == 1) {
+    MAX7219_Set_Transport(Sim_Transport);
+    Display.Own_Transport = &Sim_Parallel_Transport;
+    Display.Display_Text("Own", 0);
+    Display.Invert_Buffer();
+    Display.Display_Refresh();
+    Other_Display.Display_Refresh();
+    Chain.Visible_Image(Image);
+    if (memcmp(Image, Display.Frame_Buffer, sizeof(Image)) != 0 || Chain.Misaligned_Latches() != 0) {
+      printf("Chain does not match the frame buffer on the display's own transport\n");
+      Failures++;
+    }
+    Display.Own_Transport = NULL;
+    MAX7219_Set_Transport(Bench_Transport);
+  }
+
+  // The second chain must still show its own text
+  uint8_t Other_Image[2 * 8];
+  Other_Chain.Visible_Image(Other_Image);
+  if (memcmp(Other_Image, Other_Display.Frame_Buffer, sizeof(Other_Image)) != 0 || Other_Chain.Misaligned_Latches != 0) {
+    printf("Second chain was changed by the workloads\n");
+    Failures++;
+  }
+
+  return (Failures == 0) ? 0 : 1;
+
+}
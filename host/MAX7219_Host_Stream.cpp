@@ -0,0 +1,431 @@
+/*
+  Host test of streaming frames from a PC to the display over a serial port, on Linux through a pty
+  The display end is the display functions driving the simulated MAX7219 chain in MAX7219_Sim.h, as in the benchmark,
+  with Serial read and written on the master side of the pty. The PC end opens the other side as a serial port would be
+
+  MAX7219_Host_Stream              Self test, the PC and the display in one program on the two ends of a pty. Sends
+                                   full and delta frames, part frames, bad frames and frames faster than the display
+                                   takes them, checking the replies and what the chips light after each
+  MAX7219_Host_Stream --pty        The display on a pty, prints the port to send to and then each frame shown
+  MAX7219_Host_Stream --send Port  A PC sending an animation to the display on Port, a full frame then deltas
+
+  Returns 1 if any check failed, so it can be used as a regression test
+*/
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <termios.h>
+
+#include "../MAX7219_90_Deg_Demo/MAX7219_Functions.h"
+#include "MAX7219_Sim.h"
+
+#ifndef Number_MAX7219
+#define Number_MAX7219 8                          // Number of MAX7219 chips in the chain
+#endif
+#define Stream_CS 10                              // CS pin of the chain
+#define Stream_Step_Us 100                        // Virtual time the display runs for each step of the self test
+#define Stream_Deltas 200                         // Delta frames sent by the self test
+
+MAX7219_Matrix<Number_MAX7219, Stream_CS> Display;
+MAX7219_Sim_Chain Chain(Number_MAX7219);
+const int Frame_Size = MAX7219_Matrix<Number_MAX7219, Stream_CS>::Buffer_Size;
+uint8_t Packet[(Frame_Size * 4) + 8];             // Frame being sent, a delta of every other byte is the largest
+
+
+// ------------------------------------------------------------------------
+// Open the PC end of a port, raw so every byte goes through as it is sent
+// ------------------------------------------------------------------------
+int Open_Port(const char *Name) {
+
+  int Port = open(Name, O_RDWR | O_NOCTTY);
+  if (Port < 0) {
+    return -1;
+  }
+
+  struct termios Settings;
+  tcgetattr(Port, &Settings);
+  cfmakeraw(&Settings);
+  tcsetattr(Port, TCSANOW, &Settings);
+
+  return Port;
+
+} // end of function
+
+
+// ---------------------------------------------------------------------------------------------
+// Open a pty for the display end, Serial reads and writes the master. Returns the PC end's name
+// ---------------------------------------------------------------------------------------------
+const char *Open_Display_Port() {
+
+  int Master = posix_openpt(O_RDWR | O_NOCTTY);
+  if (Master < 0 || grantpt(Master) != 0 || unlockpt(Master) != 0) {
+    return NULL;
+  }
+
+  Serial.Port = Master;
+
+  return ptsname(Master);
+
+} // end of function
+
+
+// -------------------------------------------------------------
+// Build a full frame, returns the bytes to send
+// -------------------------------------------------------------
+size_t Frame_Full(uint8_t *Data, const uint8_t *Frame) {
+
+  size_t Length = 0;
+  uint8_t Sum = Stream_Full_Frame;
+
+  Data[Length++] = Stream_Sync;
+  Data[Length++] = Stream_Full_Frame;
+  for (int i = 0; i < Frame_Size; i++) {
+    Data[Length++] = Frame[i];
+    Sum += Frame[i];
+  }
+  Data[Length++] = Sum;
+
+  return Length;
+
+} // end of function
+
+
+// ------------------------------------------------------------------------------------------------------------------
+// Build a delta frame from Old to New, returns the bytes to send. Changed bytes up to 3 apart share a run, a gap that
+// short costs no more than a new run header
+// ------------------------------------------------------------------------------------------------------------------
+size_t Frame_Delta(uint8_t *Data, const uint8_t *Old, const uint8_t *New) {
+
+  size_t Length = 0;
+
+  Data[Length++] = Stream_Sync;
+  Data[Length++] = Stream_Delta_Frame;
+
+  for (int i = 0; i < Frame_Size; i++) {
+
+    if (Old[i] == New[i]) {
+      continue;
+    }
+
+    // Take in the changes that follow close enough
+    int End = i + 1;
+    for (int Next = End; Next < Frame_Size && (Next - End) <= 3 && (Next + 1 - i) <= 255; Next++) {
+      if (Old[Next] != New[Next]) {
+        End = Next + 1;
+      }
+    }
+
+    Data[Length++] = i & 0xFF;
+    Data[Length++] = i >> 8;
+    Data[Length++] = End - i;
+    for (; i < End; i++) {
+      Data[Length++] = New[i];
+    }
+    i--;
+
+  } // end of loop
+
+  // End of the runs
+  Data[Length++] = 0;
+  Data[Length++] = 0;
+  Data[Length++] = 0;
+
+  uint8_t Sum = 0;
+  for (size_t i = 1; i < Length; i++) {
+    Sum += Data[i];
+  }
+  Data[Length++] = Sum;
+
+  return Length;
+
+} // end of function
+
+
+// -------------------------------------------------
+// Send bytes from the PC end
+// -------------------------------------------------
+void Send(int Port, const uint8_t *Data, size_t Length) {
+
+  while (Length > 0) {
+    ssize_t Sent = write(Port, Data, Length);
+    if (Sent <= 0) {
+      return;
+    }
+    Data += Sent;
+    Length -= Sent;
+  }
+
+} // end of function
+
+
+// ----------------------------------------------------------------------------------------------------------------
+// Wait at the PC end for the display to answer, running Step while nothing has come. Returns the byte, -1 if none
+// A pty passes bytes on from a kernel work queue, not as they are written, so each step waits up to 1mS of real time
+// for them. Without it a busy machine can run all the steps before the bytes sent or the answer have come through
+// ----------------------------------------------------------------------------------------------------------------
+int Wait_Reply(int Port, void (*Step)(), unsigned long Steps) {
+
+  for (unsigned long i = 0; i < Steps; i++) {
+    struct pollfd Wait = { Port, POLLIN, 0 };
+    uint8_t Data;
+    if (poll(&Wait, 1, 1) == 1 && read(Port, &Data, 1) == 1) {
+      return Data;
+    }
+    Step();
+  }
+
+  return -1;
+
+} // end of function
+
+
+// --------------------------------------------------------------------------
+// One step of the display in the self test, the loop() of a sketch streaming
+// --------------------------------------------------------------------------
+void Display_Step() {
+
+  Display.Stream_Poll();
+  Host_Advance(Stream_Step_Us);
+
+} // end of function
+
+
+// ---------------------------------------------------------------------------
+// True if the chips light Frame and every transaction kept the chain aligned
+// ---------------------------------------------------------------------------
+bool Chain_Shows(const uint8_t *Frame) {
+
+  uint8_t Image[Frame_Size];
+  Chain.Visible_Image(Image);
+
+  return (memcmp(Image, Frame, Frame_Size) == 0 && Chain.Misaligned_Latches == 0);
+
+} // end of function
+
+
+// -----------------------------------------------
+// Print one line of the self test results
+// -----------------------------------------------
+bool Check(const char *Name, bool Passed) {
+
+  printf("%6d  Stream %-16s %s\n", Number_MAX7219, Name, Passed ? "ok" : "FAIL");
+
+  return Passed;
+
+} // end of function
+
+
+// ------------------------------------------------------------------------------------------------------------
+// The PC and the display on the two ends of a pty, the PC sends and waits for each reply while the display runs
+// Returns the checks that failed
+// ------------------------------------------------------------------------------------------------------------
+int Self_Test() {
+
+  const char *Name = Open_Display_Port();
+  int Pc = (Name != NULL) ? Open_Port(Name) : -1;
+  if (Pc < 0) {
+    printf("Could not open a pty\n");
+    return 1;
+  }
+
+  int Failures = 0;
+  uint8_t Shown[Frame_Size] = {};                 // Last frame the display should show
+  uint8_t Next[Frame_Size];
+  srand(7219);
+
+  Display.Clear_All();
+  Display.Stream_Start(Serial);
+  Failures += !Check("ready", Wait_Reply(Pc, Display_Step, 100) == Stream_Ack);
+
+  // A delta before any full frame has nothing to apply to
+  for (int i = 0; i < Frame_Size; i++) {
+    Next[i] = rand() & 0xFF;
+  }
+  Send(Pc, Packet, Frame_Delta(Packet, Shown, Next));
+  Failures += !Check("delta first", Wait_Reply(Pc, Display_Step, 100) == Stream_Nak && Chain_Shows(Shown));
+
+  // Full frame
+  size_t Full_Length = Frame_Full(Packet, Next);
+  Send(Pc, Packet, Full_Length);
+  memcpy(Shown, Next, Frame_Size);
+  Failures += !Check("full frame", Wait_Reply(Pc, Display_Step, 100) == Stream_Ack && Chain_Shows(Shown));
+
+  // Deltas, a few bytes change each frame. Every frame must be shown as sent
+  unsigned long Delta_Bytes = 0;
+  unsigned long Chain_Bytes = Chain.Bytes;
+  bool Passed = true;
+  for (int Frame = 0; Frame < Stream_Deltas && Passed == true; Frame++) {
+    for (int Changes = (rand() % 6) + 1; Changes > 0; Changes--) {
+      Next[rand() % Frame_Size] ^= (uint8_t)(1 << (rand() % 8));
+    }
+    size_t Length = Frame_Delta(Packet, Shown, Next);
+    Send(Pc, Packet, Length);
+    Delta_Bytes += Length;
+    memcpy(Shown, Next, Frame_Size);
+    Passed = (Wait_Reply(Pc, Display_Step, 100) == Stream_Ack && Chain_Shows(Shown));
+  } // end of loop
+  Chain_Bytes = Chain.Bytes - Chain_Bytes;
+  Failures += !Check("deltas", Passed);
+
+  // A frame part way in is not shown until the rest arrives
+  for (int i = 0; i < Frame_Size; i++) {
+    Next[i] = ~Shown[i];
+  }
+  Full_Length = Frame_Full(Packet, Next);
+  Send(Pc, Packet, Full_Length / 2);
+  for (int i = 0; i < 50; i++) {
+    Display_Step();
+  }
+  Passed = Chain_Shows(Shown);
+  Send(Pc, Packet + (Full_Length / 2), Full_Length - (Full_Length / 2));
+  memcpy(Shown, Next, Frame_Size);
+  Failures += !Check("part frame", Passed && Wait_Reply(Pc, Display_Step, 100) == Stream_Ack && Chain_Shows(Shown));
+
+  // A bad checksum is refused and leaves the last frame showing, deltas are then refused until a full frame
+  for (int i = 0; i < Frame_Size; i++) {
+    Next[i] = rand() & 0xFF;
+  }
+  Full_Length = Frame_Full(Packet, Next);
+  Packet[Full_Length - 1]++;
+  Send(Pc, Packet, Full_Length);
+  Passed = (Wait_Reply(Pc, Display_Step, 100) == Stream_Nak && Chain_Shows(Shown));
+  Next[0] ^= 0x01;
+  Send(Pc, Packet, Frame_Delta(Packet, Shown, Next));
+  Passed = Passed && (Wait_Reply(Pc, Display_Step, 100) == Stream_Nak && Chain_Shows(Shown));
+  Send(Pc, Packet, Frame_Full(Packet, Next));
+  memcpy(Shown, Next, Frame_Size);
+  Failures += !Check("bad checksum", Passed && Wait_Reply(Pc, Display_Step, 100) == Stream_Ack && Chain_Shows(Shown));
+
+  // A frame that stops part way is dropped after the timeout
+  Next[1] ^= 0x80;
+  Send(Pc, Packet, Frame_Full(Packet, Next) / 2);
+  unsigned long Start = micros();
+  Passed = (Wait_Reply(Pc, Display_Step, 5000) == Stream_Nak);
+  Failures += !Check("timeout", Passed && (micros() - Start) >= Display.Stream_Timeout && Chain_Shows(Shown));
+
+  // Backpressure, the PC sends two frames at once and the second waits in the port for the first's ACK
+  Display.Stream_Frame_Period = 20000;
+  Send(Pc, Packet, Frame_Full(Packet, Next));
+  Next[2] ^= 0x40;
+  Send(Pc, Packet, Frame_Full(Packet, Next));
+  Start = micros();
+  Passed = (Wait_Reply(Pc, Display_Step, 1000) == Stream_Ack);
+  unsigned long First = micros() - Start;
+  Passed = Passed && (Wait_Reply(Pc, Display_Step, 1000) == Stream_Ack);
+  unsigned long Second = micros() - Start;
+  memcpy(Shown, Next, Frame_Size);
+  Failures += !Check("backpressure", Passed && First >= 20000 && Second >= 40000 && Chain_Shows(Shown));
+  Display.Stream_Frame_Period = 0;
+
+  printf("%6d  Stream deltas bytes/frame %.1f (full %lu), chain bytes/frame %.1f\n", Number_MAX7219,
+         (double)Delta_Bytes / Stream_Deltas, (unsigned long)Full_Length, (double)Chain_Bytes / Stream_Deltas);
+
+  Display.Stream_Stop();
+  close(Pc);
+
+  return Failures;
+
+} // end of function
+
+
+// -------------------------------------------------------------------------------------------------
+// The display on a pty, for a PC program to stream to. Prints each frame shown, runs until stopped
+// -------------------------------------------------------------------------------------------------
+void Serve() {
+
+  const char *Name = Open_Display_Port();
+  if (Name == NULL) {
+    printf("Could not open a pty\n");
+    return;
+  }
+  printf("Streaming on %s\n", Name);
+  fflush(stdout);
+
+  // Keep the PC end open, so the pty is not hung up between senders
+  int Hold = Open_Port(Name);
+  (void)Hold;
+
+  Display.Clear_All();
+  Display.Stream_Start(Serial);
+
+  while (true) {
+    if (Display.Stream_Poll() == true) {
+      printf("Frame %lu, %lu bad\n", Display.Stream_Frames, Display.Stream_Errors);
+      Chain.Print();
+      fflush(stdout);
+    }
+    usleep(1000);
+    Host_Advance(1000);
+  }
+
+} // end of function
+
+
+// ------------------------------------------------------------------------------------------------------
+// A PC streaming a bar bouncing across the display to the port, waiting for each frame's ACK before the next
+// ------------------------------------------------------------------------------------------------------
+int Send_Animation(const char *Name) {
+
+  int Port = Open_Port(Name);
+  if (Port < 0) {
+    printf("Could not open %s\n", Name);
+    return 1;
+  }
+
+  // Anything the display sent before we opened the port, the ready ACK, is old news
+  tcflush(Port, TCIFLUSH);
+
+  uint8_t Old[Frame_Size] = {};
+  uint8_t New[Frame_Size];
+  bool Full = true;
+  const int Columns = MAX7219_Matrix<Number_MAX7219, Stream_CS>::Columns;
+
+  for (int Frame = 0; Frame < 4 * Columns; Frame++) {
+
+    int Bar = Frame % (2 * Columns);
+    if (Bar >= Columns) {
+      Bar = (2 * Columns) - 1 - Bar;
+    }
+    memset(New, 0, Frame_Size);
+    for (uint8_t ii = 0; ii < 8; ii++) {
+      bitSet(New[((Bar / 8) * 8) + ii], Bar % 8);
+    }
+
+    Send(Port, Packet, (Full == true) ? Frame_Full(Packet, New) : Frame_Delta(Packet, Old, New));
+    int Reply = Wait_Reply(Port, [] { usleep(1000); }, 1000);
+    if (Reply == -1) {
+      printf("No reply from the display\n");
+      return 1;
+    }
+    Full = (Reply != Stream_Ack);
+    if (Full == false) {
+      memcpy(Old, New, Frame_Size);
+    }
+
+  } // end of loop
+
+  return 0;
+
+} // end of function
+
+
+int main(int argc, char **argv) {
+
+  MAX7219_Set_Transport(Sim_Transport);
+  MAX7219_Sim_Attach(Stream_CS, &Chain);
+  Display.MAX7219_Init();
+
+  if (argc >= 2 && strcmp(argv[1], "--pty") == 0) {
+    Serve();
+    return 0;
+  }
+  if (argc >= 3 && strcmp(argv[1], "--send") == 0) {
+    return Send_Animation(argv[2]);
+  }
+
+  return (Self_Test() == 0) ? 0 : 1;
+
+}
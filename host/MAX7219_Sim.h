@@ -0,0 +1,330 @@
+/*
+  Simulated chain of MAX7219 chips for the host build
+
+  Models the chips at the serial clock level. Every byte sent is clocked one bit at a time (MSB first) into the 16 bit
+  shift register of the first chip, the bit shifted out of each chip's D15 feeds the next chip in the chain. As on the
+  MAX7219, data shifts in regardless of CS, on the rising edge of CS every chip latches D11-D8 as the register address and
+  D7-D0 as the data, address 0 is the no-op register. Chip 0 is the first chip in the chain (far left of the display).
+
+  Power up is as the datasheet, control registers cleared (so shut down and blank) and the digit registers hold rubbish,
+  the display functions have to initialise and fully write the chips before the simulated image matches the frame buffer.
+
+  The visible image takes shutdown, display test, scan limit and decode mode into account, so it is what would be lit.
+*/
+
+#ifndef MAX7219_SIM_H
+#define MAX7219_SIM_H
+
+#include <vector>
+
+class MAX7219_Sim_Chain {
+  public:
+
+    MAX7219_Sim_Chain(int Chips) : Chip_Count(Chips), Shift_Register(Chips, 0), Registers(Chips * 16, 0) {
+
+      // Digit registers are not reset at power up, fill them with a pattern that will show if they are never written
+      for (int xx = 0; xx < Chips; xx++) {
+        for (uint8_t Digit = 1; Digit <= 8; Digit++) {
+          Registers[(xx * 16) + Digit] = (uint8_t)(0xA5 ^ (xx * 8 + Digit));
+        }
+      }
+
+      Reset_Counters();
+
+    }
+
+    int Chips() const {
+      return Chip_Count;
+    }
+
+    // Wire activity since the last Reset_Counters
+    unsigned long Bytes;                          // Bytes clocked while this chain was selected
+    unsigned long Cs_Toggles;                     // CS edges, two per transaction
+    unsigned long Transactions;                   // CS low to CS high cycles
+    unsigned long Misaligned_Latches;             // Transactions that were not a whole number of 16 bit words for the chain
+
+    void Reset_Counters() {
+      Bytes = 0;
+      Cs_Toggles = 0;
+      Transactions = 0;
+      Misaligned_Latches = 0;
+    }
+
+    // CS low, the start of a transaction
+    void Select() {
+      if (Selected == false) {
+        Selected = true;
+        Cs_Toggles++;
+        Bits_This_Transaction = 0;
+      }
+    }
+
+    // Clock one byte into the chain, MSB first. The chips shift whether or not they are selected
+    void Clock_Byte(uint8_t Data) {
+
+      for (int Bit = 7; Bit >= 0; Bit--) {
+
+        uint16_t Carry = (Data >> Bit) & 0x01;
+
+        for (int xx = 0; xx < Chip_Count; xx++) {
+          uint16_t Out = Shift_Register[xx] >> 15;
+          Shift_Register[xx] = (uint16_t)((Shift_Register[xx] << 1) | Carry);
+          Carry = Out;
+        }
+
+      } // end of bit loop
+
+      if (Selected == true) {
+        Bytes++;
+        Bits_This_Transaction += 8;
+      }
+
+    }
+
+    // CS high, every chip latches the word in its shift register
+    void Deselect() {
+
+      if (Selected == false) {
+        return;
+      }
+
+      Selected = false;
+      Cs_Toggles++;
+      Transactions++;
+
+      if ((Bits_This_Transaction % (16 * Chip_Count)) != 0) {
+        Misaligned_Latches++;
+      }
+
+      for (int xx = 0; xx < Chip_Count; xx++) {
+        uint8_t Address = (Shift_Register[xx] >> 8) & 0x0F;
+        if (Address != 0) {
+          Registers[(xx * 16) + Address] = Shift_Register[xx] & 0xFF;
+        }
+      }
+
+    }
+
+    // Raw register contents, Address 1-8 digits, 9-F control registers
+    uint8_t Register(int Chip, uint8_t Address) const {
+      return Registers[(Chip * 16) + (Address & 0x0F)];
+    }
+
+    // Change a register without a transaction, as noise on the lines might
+    void Upset(int Chip, uint8_t Address, uint8_t Data) {
+      Registers[(Chip * 16) + (Address & 0x0F)] = Data;
+    }
+
+    // What the chip is lighting for a digit (1-8), one bit per LED as the digit register
+    uint8_t Visible_Digit(int Chip, uint8_t Digit) const {
+
+      // Code B font, for digits in decode mode
+      static const uint8_t Code_B[16] = { 0x7E, 0x30, 0x6D, 0x79, 0x33, 0x5B, 0x5F, 0x70, 0x7F, 0x7B, 0x01, 0x4F, 0x37, 0x0E, 0x67, 0x00 };
+
+      if ((Register(Chip, 0x0F) & 0x01) == 1) {
+        return 0xFF;                              // Display test, all on
+      }
+      if ((Register(Chip, 0x0C) & 0x01) == 0) {
+        return 0x00;                              // Shutdown, blank
+      }
+      if ((Digit - 1) > (Register(Chip, 0x0B) & 0x07)) {
+        return 0x00;                              // Not scanned
+      }
+
+      uint8_t Data = Register(Chip, Digit);
+      if (bitRead(Register(Chip, 0x09), Digit - 1) == 1) {
+        Data = (Data & 0x80) | Code_B[Data & 0x0F];
+      }
+      return Data;
+
+    }
+
+    // The visible image in the frame buffer layout, chip x digit r is byte (x * 8) + (8 - r)
+    void Visible_Image(uint8_t *Image) const {
+      for (int xx = 0; xx < Chip_Count; xx++) {
+        for (uint8_t Digit = 1; Digit <= 8; Digit++) {
+          Image[(xx * 8) + (8 - Digit)] = Visible_Digit(xx, Digit);
+        }
+      }
+    }
+
+    // One pixel of the visible image, Display_Column from the far left, Row from the top
+    bool Pixel(int Display_Column, int Row) const {
+      return bitRead(Visible_Digit(Display_Column / 8, 8 - Row), Display_Column % 8) == 1;
+    }
+
+    // Print the visible image, one line per row
+    void Print() const {
+      for (int Row = 0; Row < 8; Row++) {
+        for (int Display_Column = 0; Display_Column < (Chip_Count * 8); Display_Column++) {
+          fputc(Pixel(Display_Column, Row) ? '#' : '.', stdout);
+        }
+        fputc('\n', stdout);
+      }
+    }
+
+  private:
+    int Chip_Count;
+    std::vector<uint16_t> Shift_Register;
+    std::vector<uint8_t> Registers;
+    bool Selected = false;
+    unsigned long Bits_This_Transaction = 0;
+};
+
+
+// -----------------------------------------------------------------------------------------------------------------
+// A display split into equal chains, each a simulated chain of its own, seen as one chain of all the chips. Part k is
+// the k'th chain from the left. Parallel = true the chains share CS (the counts of CS edges and transactions are those
+// of one chain), false each has its own CS (the counts are added up)
+// -----------------------------------------------------------------------------------------------------------------
+class MAX7219_Sim_Split {
+  public:
+
+    MAX7219_Sim_Split(int Chips, int Chains, bool Is_Parallel) : Chain_Chips(Chips / Chains), Parallel(Is_Parallel) {
+      for (int k = 0; k < Chains; k++) {
+        Parts.push_back(new MAX7219_Sim_Chain(Chain_Chips));
+      }
+      Reset_Counters();
+    }
+
+    MAX7219_Sim_Chain &Part(int k) {
+      return *Parts[k];
+    }
+
+    int Chains() const {
+      return (int)Parts.size();
+    }
+
+    // Wire activity since the last Reset_Counters, as the counts of MAX7219_Sim_Chain
+    unsigned long Bytes() const {
+      unsigned long Total = 0;
+      for (MAX7219_Sim_Chain *Chain : Parts) {
+        Total += Chain->Bytes;
+      }
+      return Total;
+    }
+
+    unsigned long Cs_Toggles() const {
+      return Count(&MAX7219_Sim_Chain::Cs_Toggles);
+    }
+
+    unsigned long Transactions() const {
+      return Count(&MAX7219_Sim_Chain::Transactions);
+    }
+
+    unsigned long Misaligned_Latches() const {
+      unsigned long Total = 0;
+      for (MAX7219_Sim_Chain *Chain : Parts) {
+        Total += Chain->Misaligned_Latches;
+      }
+      return Total;
+    }
+
+    void Reset_Counters() {
+      for (MAX7219_Sim_Chain *Chain : Parts) {
+        Chain->Reset_Counters();
+      }
+    }
+
+    // The visible image of all the chains side by side, in the frame buffer layout
+    void Visible_Image(uint8_t *Image) const {
+      for (size_t k = 0; k < Parts.size(); k++) {
+        Parts[k]->Visible_Image(Image + (k * Chain_Chips * 8));
+      }
+    }
+
+    void Upset(int Chip, uint8_t Address, uint8_t Data) {
+      Parts[Chip / Chain_Chips]->Upset(Chip % Chain_Chips, Address, Data);
+    }
+
+  private:
+    int Chain_Chips;
+    bool Parallel;
+    std::vector<MAX7219_Sim_Chain *> Parts;
+
+    // Sharing CS every chain sees every transaction, count them once
+    unsigned long Count(unsigned long MAX7219_Sim_Chain::*Item) const {
+      unsigned long Total = 0;
+      for (MAX7219_Sim_Chain *Chain : Parts) {
+        if (Parallel == true) {
+          Total = (Chain->*Item > Total) ? Chain->*Item : Total;
+        }
+        else {
+          Total += Chain->*Item;
+        }
+      }
+      return Total;
+    }
+};
+
+
+// ----------------------------------------------------------------------------------------------------------------
+// Transport for the display functions. Chains are attached to a CS pin and a DIN lane, lane 0 is the SPI data line
+// all chains share unless they have a DIN of their own. Each byte is clocked into every chain on the lane but only
+// the chains whose CS goes high latch it. Transfer_Lanes clocks lane k into the chains on lane k, all at once
+// ----------------------------------------------------------------------------------------------------------------
+MAX7219_Sim_Chain *Sim_Chains[256][MAX7219_Lanes_Max];
+unsigned long Sim_Transfer_Calls = 0;             // Calls made to the transport to send data, a block is one call
+unsigned long Sim_Bus_Bytes = 0;                  // Byte times on the wire, lanes sent together take the time of one
+unsigned long Sim_Byte_Us = 0;                    // Time the clock moves on for each byte time on the wire, 1 is SPI at 8 MHz
+
+void MAX7219_Sim_Attach(uint8_t Cs_Pin, MAX7219_Sim_Chain *Chain, uint8_t Lane = 0) {
+  Sim_Chains[Cs_Pin][Lane] = Chain;
+}
+
+void Sim_Select(uint8_t Cs_Pin) {
+  for (int Lane = 0; Lane < MAX7219_Lanes_Max; Lane++) {
+    if (Sim_Chains[Cs_Pin][Lane] != NULL) {
+      Sim_Chains[Cs_Pin][Lane]->Select();
+    }
+  }
+}
+
+void Sim_Clock_Lane(int Lane, uint8_t Data) {
+  for (int Pin = 0; Pin < 256; Pin++) {
+    if (Sim_Chains[Pin][Lane] != NULL) {
+      Sim_Chains[Pin][Lane]->Clock_Byte(Data);
+    }
+  }
+}
+
+void Sim_Transfer(uint8_t Data) {
+  Sim_Transfer_Calls++;
+  Sim_Bus_Bytes++;
+  Host_Advance(Sim_Byte_Us);
+  Sim_Clock_Lane(0, Data);
+}
+
+void Sim_Transfer_Block(uint8_t *Data, uint16_t Length) {
+  Sim_Transfer_Calls++;
+  Sim_Bus_Bytes += Length;
+  Host_Advance(Length * Sim_Byte_Us);
+  for (uint16_t i = 0; i < Length; i++) {
+    Sim_Clock_Lane(0, Data[i]);
+  }
+}
+
+void Sim_Transfer_Lanes(uint8_t *Data, uint16_t Length, uint8_t Lanes) {
+  Sim_Transfer_Calls++;
+  Sim_Bus_Bytes += Length;
+  Host_Advance(Length * Sim_Byte_Us);
+  for (uint8_t k = 0; k < Lanes; k++) {
+    for (uint16_t i = 0; i < Length; i++) {
+      Sim_Clock_Lane(k, Data[((Lanes - 1 - k) * Length) + i]);
+    }
+  }
+}
+
+void Sim_Deselect(uint8_t Cs_Pin) {
+  for (int Lane = 0; Lane < MAX7219_Lanes_Max; Lane++) {
+    if (Sim_Chains[Cs_Pin][Lane] != NULL) {
+      Sim_Chains[Cs_Pin][Lane]->Deselect();
+    }
+  }
+}
+
+// One DIN line, and with a DIN line for each chain of a split display
+const MAX7219_Transport Sim_Transport = { Sim_Select, Sim_Transfer, Sim_Deselect, Sim_Transfer_Block, NULL };
+const MAX7219_Transport Sim_Parallel_Transport = { Sim_Select, Sim_Transfer, Sim_Deselect, Sim_Transfer_Block, Sim_Transfer_Lanes };
+
+#endif
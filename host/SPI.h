@@ -0,0 +1,23 @@
+/*
+  Host stand in for the Arduino SPI library. Nothing is sent, the host build replaces
+  the SPI transport with the simulated chain in MAX7219_Sim.h
+*/
+
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include "Arduino.h"
+
+class SPIClass {
+  public:
+    void begin() {}
+    void setBitOrder(uint8_t Order) { (void)Order; }
+    void setFrequency(uint32_t Frequency) { (void)Frequency; }
+    uint8_t transfer(uint8_t Data) { (void)Data; return 0; }
+    void transfer(void *Data, size_t Length) { (void)Data; (void)Length; }
+    void writeBytes(const uint8_t *Data, uint32_t Length) { (void)Data; (void)Length; }
+};
+
+static SPIClass SPI;
+
+#endif